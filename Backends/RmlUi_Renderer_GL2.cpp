@@ -305,6 +305,26 @@ bool RenderInterface_GL2::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL2::SupportsTextureUpdates()
+{
+	return true;
+}
+
+bool RenderInterface_GL2::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+	const Rml::byte* source, int source_stride)
+{
+	if (source_stride % 4 != 0)
+		return false;
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, source_stride / 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region_offset.x, region_offset.y, region_dimensions.x, region_dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+	return true;
+}
+
 void RenderInterface_GL2::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	glDeleteTextures(1, (GLuint*)&texture_handle);
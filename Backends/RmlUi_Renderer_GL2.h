@@ -55,6 +55,9 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool SupportsTextureUpdates() override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -55,6 +55,7 @@
 static const char* shader_main_vertex = RMLUI_SHADER_HEADER R"(
 uniform vec2 _translate;
 uniform mat4 _transform;
+uniform vec4 _colorMultiplier;
 
 in vec2 inPosition;
 in vec4 inColor0;
@@ -65,7 +66,7 @@ out vec4 fragColor;
 
 void main() {
 	fragTexCoord = inTexCoord0;
-	fragColor = inColor0;
+	fragColor = inColor0 * _colorMultiplier;
 
 	vec2 translatedPos = inPosition + _translate.xy;
 	vec4 outPos = _transform * vec4(translatedPos, 0, 1);
@@ -86,6 +87,20 @@ void main() {
 	finalColor = fragColor * texColor;
 }
 )";
+static const char* shader_main_fragment_distance_field = RMLUI_SHADER_HEADER R"(
+uniform sampler2D _tex;
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+void main() {
+	float distance = texture(_tex, fragTexCoord).a;
+	float width = 0.5 * fwidth(distance);
+	float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+	finalColor = vec4(fragColor.rgb, fragColor.a * alpha);
+}
+)";
 static const char* shader_main_fragment_color = RMLUI_SHADER_HEADER R"(
 in vec2 fragTexCoord;
 in vec4 fragColor;
@@ -99,8 +114,8 @@ void main() {
 
 namespace Gfx {
 
-enum class ProgramUniform { Translate, Transform, Tex, Count };
-static const char* const program_uniform_names[(size_t)ProgramUniform::Count] = {"_translate", "_transform", "_tex"};
+enum class ProgramUniform { Translate, Transform, ColorMultiplier, Tex, Count };
+static const char* const program_uniform_names[(size_t)ProgramUniform::Count] = {"_translate", "_transform", "_colorMultiplier", "_tex"};
 
 enum class VertexAttribute { Position, Color0, TexCoord0, Count };
 static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0"};
@@ -121,9 +136,11 @@ struct ProgramData {
 struct ShadersData {
 	ProgramData program_color;
 	ProgramData program_texture;
+	ProgramData program_distance_field;
 	GLuint shader_main_vertex;
 	GLuint shader_main_fragment_color;
 	GLuint shader_main_fragment_texture;
+	GLuint shader_main_fragment_distance_field;
 };
 
 static void CheckGLError(const char* operation_name)
@@ -267,6 +284,7 @@ static bool CreateShaders(ShadersData& out_shaders)
 	GLuint& main_vertex = out_shaders.shader_main_vertex;
 	GLuint& main_fragment_color = out_shaders.shader_main_fragment_color;
 	GLuint& main_fragment_texture = out_shaders.shader_main_fragment_texture;
+	GLuint& main_fragment_distance_field = out_shaders.shader_main_fragment_distance_field;
 
 	main_vertex = CreateShader(GL_VERTEX_SHADER, shader_main_vertex);
 	if (!main_vertex)
@@ -286,6 +304,12 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_texture'.");
 		return false;
 	}
+	main_fragment_distance_field = CreateShader(GL_FRAGMENT_SHADER, shader_main_fragment_distance_field);
+	if (!main_fragment_distance_field)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_distance_field'.");
+		return false;
+	}
 
 	if (!CreateProgram(main_vertex, main_fragment_color, out_shaders.program_color))
 	{
@@ -297,6 +321,11 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_texture'.");
 		return false;
 	}
+	if (!CreateProgram(main_vertex, main_fragment_distance_field, out_shaders.program_distance_field))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_distance_field'.");
+		return false;
+	}
 
 	return true;
 }
@@ -305,10 +334,12 @@ static void DestroyShaders(ShadersData& shaders)
 {
 	glDeleteProgram(shaders.program_color.id);
 	glDeleteProgram(shaders.program_texture.id);
+	glDeleteProgram(shaders.program_distance_field.id);
 
 	glDeleteShader(shaders.shader_main_vertex);
 	glDeleteShader(shaders.shader_main_fragment_color);
 	glDeleteShader(shaders.shader_main_fragment_texture);
+	glDeleteShader(shaders.shader_main_fragment_distance_field);
 
 	shaders = {};
 }
@@ -425,25 +456,50 @@ Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGeometry(Rml::Vertex* ve
 }
 
 void RenderInterface_GL3::RenderCompiledGeometry(Rml::CompiledGeometryHandle handle, const Rml::Vector2f& translation)
+{
+	RenderCompiledGeometryWithColour(handle, translation, Rml::Colourb(255));
+}
+
+bool RenderInterface_GL3::SupportsColourMultiplier()
+{
+	return true;
+}
+
+void RenderInterface_GL3::RenderCompiledGeometryWithColour(Rml::CompiledGeometryHandle handle, const Rml::Vector2f& translation,
+	const Rml::Colourb& colour_multiplier)
 {
 	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
+	const Gfx::ProgramData* program = nullptr;
 
-	if (geometry->texture)
+	if (geometry->texture && geometry->texture != TextureEnableWithoutBinding && distance_field_textures.count(geometry->texture))
+	{
+		program = &shaders->program_distance_field;
+		glUseProgram(program->id);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
+		SubmitTransformUniform(ProgramId::DistanceField, program->uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
+	}
+	else if (geometry->texture)
 	{
-		glUseProgram(shaders->program_texture.id);
+		program = &shaders->program_texture;
+		glUseProgram(program->id);
 		if (geometry->texture != TextureEnableWithoutBinding)
 			glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
-		SubmitTransformUniform(ProgramId::Texture, shaders->program_texture.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
-		glUniform2fv(shaders->program_texture.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+		SubmitTransformUniform(ProgramId::Texture, program->uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
 	}
 	else
 	{
-		glUseProgram(shaders->program_color.id);
+		program = &shaders->program_color;
+		glUseProgram(program->id);
 		glBindTexture(GL_TEXTURE_2D, 0);
-		SubmitTransformUniform(ProgramId::Color, shaders->program_color.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
-		glUniform2fv(shaders->program_color.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+		SubmitTransformUniform(ProgramId::Color, program->uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
 	}
 
+	glUniform2fv(program->uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+
+	const Rml::Colourf colour_multiplier_f = Rml::Colourf(colour_multiplier.red, colour_multiplier.green, colour_multiplier.blue,
+		colour_multiplier.alpha) / 255.f;
+	glUniform4fv(program->uniform_locations[(size_t)Gfx::ProgramUniform::ColorMultiplier], 1, &colour_multiplier_f.red);
+
 	glBindVertexArray(geometry->vao);
 	glDrawElements(GL_TRIANGLES, geometry->draw_count, GL_UNSIGNED_INT, (const GLvoid*)0);
 	glBindVertexArray(0);
@@ -655,8 +711,44 @@ bool RenderInterface_GL3::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL3::SupportsTextureUpdates()
+{
+	return true;
+}
+
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+	const Rml::byte* source, int source_stride)
+{
+	if (source_stride % 4 != 0)
+		return false;
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, source_stride / 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region_offset.x, region_offset.y, region_dimensions.x, region_dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+	return true;
+}
+
+bool RenderInterface_GL3::SupportsDistanceFieldTextures()
+{
+	return true;
+}
+
+bool RenderInterface_GL3::GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source,
+	const Rml::Vector2i& source_dimensions)
+{
+	if (!GenerateTexture(texture_handle, source, source_dimensions))
+		return false;
+
+	distance_field_textures.insert(texture_handle);
+	return true;
+}
+
 void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
+	distance_field_textures.erase(texture_handle);
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
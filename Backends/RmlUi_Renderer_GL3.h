@@ -62,6 +62,9 @@ public:
 	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
 		Rml::TextureHandle texture) override;
 	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	bool SupportsColourMultiplier() override;
+	void RenderCompiledGeometryWithColour(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation,
+		const Rml::Colourb& colour_multiplier) override;
 	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
 
 	void EnableScissorRegion(bool enable) override;
@@ -69,6 +72,11 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool SupportsTextureUpdates() override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
+	bool SupportsDistanceFieldTextures() override;
+	bool GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -77,7 +85,7 @@ public:
 	static const Rml::TextureHandle TextureEnableWithoutBinding = Rml::TextureHandle(-1);
 
 private:
-	enum class ProgramId { None, Texture = 1, Color = 2, All = (Texture | Color) };
+	enum class ProgramId { None, Texture = 1, Color = 2, DistanceField = 4, All = (Texture | Color | DistanceField) };
 	void SubmitTransformUniform(ProgramId program_id, int uniform_location);
 
 	Rml::Matrix4f transform, projection;
@@ -90,6 +98,9 @@ private:
 	int viewport_width = 0;
 	int viewport_height = 0;
 
+	// Textures generated from distance fields, these are rendered with the distance field program.
+	Rml::UnorderedSet<Rml::TextureHandle> distance_field_textures;
+
 	Rml::UniquePtr<Gfx::ShadersData> shaders;
 };
 
@@ -681,6 +681,91 @@ bool RenderInterface_VK::CreateTexture(Rml::TextureHandle& texture_handle, const
 	return true;
 }
 
+bool RenderInterface_VK::SupportsTextureUpdates()
+{
+	return true;
+}
+
+bool RenderInterface_VK::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset,
+	const Rml::Vector2i& region_dimensions, const Rml::byte* source, int source_stride)
+{
+	RMLUI_ZoneScopedN("Vulkan - UpdateTexture");
+
+	texture_data_t* p_texture = reinterpret_cast<texture_data_t*>(texture_handle);
+	if (!p_texture || !source || region_dimensions.x <= 0 || region_dimensions.y <= 0)
+		return false;
+
+	const size_t bytes_per_row = static_cast<size_t>(region_dimensions.x) * 4;
+	VkDeviceSize region_size = bytes_per_row * region_dimensions.y;
+
+	buffer_data_t cpu_buffer = CreateResource_StagingBuffer(region_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+	// Pack the region rows tightly into the staging buffer.
+	void* data;
+	vmaMapMemory(m_p_allocator, cpu_buffer.m_p_vma_allocation, &data);
+	for (int y = 0; y < region_dimensions.y; y++)
+		memcpy(static_cast<Rml::byte*>(data) + y * bytes_per_row, source + y * source_stride, bytes_per_row);
+	vmaUnmapMemory(m_p_allocator, cpu_buffer.m_p_vma_allocation);
+
+	VkImage p_image = p_texture->m_p_vk_image;
+
+	/*
+	 * Unlike in CreateTexture, the image is already in use by the shaders. Thus, we transition it from the shader read layout for the
+	 * transfer, making sure any previously submitted reads have finished, and then back again. The existing contents are preserved.
+	 */
+	m_upload_manager.UploadToGPU([p_image, region_offset, region_dimensions, cpu_buffer](VkCommandBuffer p_cmd) {
+		VkImageSubresourceRange range = {};
+		range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		range.baseMipLevel = 0;
+		range.baseArrayLayer = 0;
+		range.levelCount = 1;
+		range.layerCount = 1;
+
+		VkImageMemoryBarrier info_barrier = {};
+		info_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		info_barrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		info_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		info_barrier.image = p_image;
+		info_barrier.subresourceRange = range;
+		info_barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		info_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(p_cmd, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+			&info_barrier);
+
+		VkBufferImageCopy region = {};
+		region.bufferOffset = 0;
+		region.bufferRowLength = 0;
+		region.bufferImageHeight = 0;
+
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = {region_offset.x, region_offset.y, 0};
+		region.imageExtent = {static_cast<uint32_t>(region_dimensions.x), static_cast<uint32_t>(region_dimensions.y), 1};
+
+		vkCmdCopyBufferToImage(p_cmd, cpu_buffer.m_p_vk_buffer, p_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+		VkImageMemoryBarrier info_barrier_shader_read = {};
+		info_barrier_shader_read.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		info_barrier_shader_read.pNext = nullptr;
+		info_barrier_shader_read.image = p_image;
+		info_barrier_shader_read.subresourceRange = range;
+		info_barrier_shader_read.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		info_barrier_shader_read.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		info_barrier_shader_read.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		info_barrier_shader_read.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+		vkCmdPipelineBarrier(p_cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+			&info_barrier_shader_read);
+	});
+
+	DestroyResource_StagingBuffer(cpu_buffer);
+
+	return true;
+}
+
 void RenderInterface_VK::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	texture_data_t* p_texture = reinterpret_cast<texture_data_t*>(texture_handle);
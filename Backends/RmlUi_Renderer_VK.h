@@ -146,6 +146,11 @@ public:
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	/// Called by RmlUi to query whether regions of generated textures can be updated.
+	bool SupportsTextureUpdates() override;
+	/// Called by RmlUi when it wants to update a region of a generated texture.
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
 
 	/// Called by RmlUi when a loaded texture is no longer required.
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
@@ -194,79 +194,79 @@ namespace Style {
 
 	class ComputedValues : NonCopyMoveable {
 	public:
-		ComputedValues(Element* element) : element(element) {}
+		ComputedValues(Element* element) : element(element), data(MakeShared<Data>()) {}
 
 		// clang-format off
 		
 		// -- Common --
-		LengthPercentageAuto width()               const { return LengthPercentageAuto(common.width_type, common.width_value); }
-		LengthPercentageAuto height()              const { return LengthPercentageAuto(common.height_type, common.height_value); }
-		LengthPercentageAuto margin_top()          const { return LengthPercentageAuto(common.margin_top_type, common.margin_top_value); }
-		LengthPercentageAuto margin_right()        const { return LengthPercentageAuto(common.margin_right_type, common.margin_right_value); }
-		LengthPercentageAuto margin_bottom()       const { return LengthPercentageAuto(common.margin_bottom_type, common.margin_bottom_value); }
-		LengthPercentageAuto margin_left()         const { return LengthPercentageAuto(common.margin_left_type, common.margin_left_value); }
-		LengthPercentage     padding_top()         const { return LengthPercentage(common.padding_top_type, common.padding_top_value); }
-		LengthPercentage     padding_right()       const { return LengthPercentage(common.padding_right_type, common.padding_right_value); }
-		LengthPercentage     padding_bottom()      const { return LengthPercentage(common.padding_bottom_type, common.padding_bottom_value); }
-		LengthPercentage     padding_left()        const { return LengthPercentage(common.padding_left_type, common.padding_left_value); }
-		LengthPercentageAuto top()                 const { return LengthPercentageAuto(common.top_type, common.top_value); }
-		LengthPercentageAuto right()               const { return LengthPercentageAuto(common.right_type, common.right_value); }
-		LengthPercentageAuto bottom()              const { return LengthPercentageAuto(common.bottom_type, common.bottom_value); }
-		LengthPercentageAuto left()                const { return LengthPercentageAuto(common.left_type, common.left_value); }
-		NumberAuto           z_index()             const { return NumberAuto(common.z_index_type, common.z_index_value); }
-		float                border_top_width()    const { return (float)common.border_top_width; }
-		float                border_right_width()  const { return (float)common.border_right_width; }
-		float                border_bottom_width() const { return (float)common.border_bottom_width; }
-		float                border_left_width()   const { return (float)common.border_left_width; }
-		BoxSizing            box_sizing()          const { return common.box_sizing; }
-		Display              display()             const { return common.display; }
-		Position             position()            const { return common.position; }
-		Float                float_()              const { return common.float_; }
-		Clear                clear()               const { return common.clear; }
-		Overflow             overflow_x()          const { return common.overflow_x; }
-		Overflow             overflow_y()          const { return common.overflow_y; }
-		Visibility           visibility()          const { return common.visibility; }
-		Colourb              background_color()    const { return common.background_color; }
-		Colourb              border_top_color()    const { return common.border_top_color; }
-		Colourb              border_right_color()  const { return common.border_right_color; }
-		Colourb              border_bottom_color() const { return common.border_bottom_color; }
-		Colourb              border_left_color()   const { return common.border_left_color; }
-		bool                 has_decorator()       const { return common.has_decorator; }
+		LengthPercentageAuto width()               const { return LengthPercentageAuto(data->common.width_type, data->common.width_value); }
+		LengthPercentageAuto height()              const { return LengthPercentageAuto(data->common.height_type, data->common.height_value); }
+		LengthPercentageAuto margin_top()          const { return LengthPercentageAuto(data->common.margin_top_type, data->common.margin_top_value); }
+		LengthPercentageAuto margin_right()        const { return LengthPercentageAuto(data->common.margin_right_type, data->common.margin_right_value); }
+		LengthPercentageAuto margin_bottom()       const { return LengthPercentageAuto(data->common.margin_bottom_type, data->common.margin_bottom_value); }
+		LengthPercentageAuto margin_left()         const { return LengthPercentageAuto(data->common.margin_left_type, data->common.margin_left_value); }
+		LengthPercentage     padding_top()         const { return LengthPercentage(data->common.padding_top_type, data->common.padding_top_value); }
+		LengthPercentage     padding_right()       const { return LengthPercentage(data->common.padding_right_type, data->common.padding_right_value); }
+		LengthPercentage     padding_bottom()      const { return LengthPercentage(data->common.padding_bottom_type, data->common.padding_bottom_value); }
+		LengthPercentage     padding_left()        const { return LengthPercentage(data->common.padding_left_type, data->common.padding_left_value); }
+		LengthPercentageAuto top()                 const { return LengthPercentageAuto(data->common.top_type, data->common.top_value); }
+		LengthPercentageAuto right()               const { return LengthPercentageAuto(data->common.right_type, data->common.right_value); }
+		LengthPercentageAuto bottom()              const { return LengthPercentageAuto(data->common.bottom_type, data->common.bottom_value); }
+		LengthPercentageAuto left()                const { return LengthPercentageAuto(data->common.left_type, data->common.left_value); }
+		NumberAuto           z_index()             const { return NumberAuto(data->common.z_index_type, data->common.z_index_value); }
+		float                border_top_width()    const { return (float)data->common.border_top_width; }
+		float                border_right_width()  const { return (float)data->common.border_right_width; }
+		float                border_bottom_width() const { return (float)data->common.border_bottom_width; }
+		float                border_left_width()   const { return (float)data->common.border_left_width; }
+		BoxSizing            box_sizing()          const { return data->common.box_sizing; }
+		Display              display()             const { return data->common.display; }
+		Position             position()            const { return data->common.position; }
+		Float                float_()              const { return data->common.float_; }
+		Clear                clear()               const { return data->common.clear; }
+		Overflow             overflow_x()          const { return data->common.overflow_x; }
+		Overflow             overflow_y()          const { return data->common.overflow_y; }
+		Visibility           visibility()          const { return data->common.visibility; }
+		Colourb              background_color()    const { return data->common.background_color; }
+		Colourb              border_top_color()    const { return data->common.border_top_color; }
+		Colourb              border_right_color()  const { return data->common.border_right_color; }
+		Colourb              border_bottom_color() const { return data->common.border_bottom_color; }
+		Colourb              border_left_color()   const { return data->common.border_left_color; }
+		bool                 has_decorator()       const { return data->common.has_decorator; }
 		
 		// -- Inherited --
 		String         font_family()      const;
 		String         cursor()           const;
-		FontFaceHandle font_face_handle() const { return inherited.font_face_handle; }
-		float          font_size()        const { return inherited.font_size; }
-		bool           has_font_effect()  const { return inherited.has_font_effect; }
-		FontStyle      font_style()       const { return inherited.font_style; }
-		FontWeight     font_weight()      const { return inherited.font_weight; }
-		PointerEvents  pointer_events()   const { return inherited.pointer_events; }
-		Focus          focus()            const { return inherited.focus; }
-		TextAlign      text_align()       const { return inherited.text_align; }
-		TextDecoration text_decoration()  const { return inherited.text_decoration; }
-		TextTransform  text_transform()   const { return inherited.text_transform; }
-		WhiteSpace     white_space()      const { return inherited.white_space; }
-		WordBreak      word_break()       const { return inherited.word_break; }
-		Colourb        color()            const { return inherited.color; }
-		float          opacity()          const { return inherited.opacity; }
-		LineHeight     line_height()      const { return LineHeight(inherited.line_height, inherited.line_height_inherit_type, inherited.line_height_inherit); }
+		FontFaceHandle font_face_handle() const { return data->inherited.font_face_handle; }
+		float          font_size()        const { return data->inherited.font_size; }
+		bool           has_font_effect()  const { return data->inherited.has_font_effect; }
+		FontStyle      font_style()       const { return data->inherited.font_style; }
+		FontWeight     font_weight()      const { return data->inherited.font_weight; }
+		PointerEvents  pointer_events()   const { return data->inherited.pointer_events; }
+		Focus          focus()            const { return data->inherited.focus; }
+		TextAlign      text_align()       const { return data->inherited.text_align; }
+		TextDecoration text_decoration()  const { return data->inherited.text_decoration; }
+		TextTransform  text_transform()   const { return data->inherited.text_transform; }
+		WhiteSpace     white_space()      const { return data->inherited.white_space; }
+		WordBreak      word_break()       const { return data->inherited.word_break; }
+		Colourb        color()            const { return data->inherited.color; }
+		float          opacity()          const { return data->inherited.opacity; }
+		LineHeight     line_height()      const { return LineHeight(data->inherited.line_height, data->inherited.line_height_inherit_type, data->inherited.line_height_inherit); }
 
 		// -- Rare --
-		MinWidth          min_width()                  const { return LengthPercentage(rare.min_width_type, rare.min_width); }
-		MaxWidth          max_width()                  const { return LengthPercentage(rare.max_width_type, rare.max_width); }
-		MinHeight         min_height()                 const { return LengthPercentage(rare.min_height_type, rare.min_height); }
-		MinHeight         max_height()                 const { return LengthPercentage(rare.max_height_type, rare.max_height); }
-		VerticalAlign     vertical_align()             const { return VerticalAlign(rare.vertical_align_type, rare.vertical_align_length); }
+		MinWidth          min_width()                  const { return LengthPercentage(data->rare.min_width_type, data->rare.min_width); }
+		MaxWidth          max_width()                  const { return LengthPercentage(data->rare.max_width_type, data->rare.max_width); }
+		MinHeight         min_height()                 const { return LengthPercentage(data->rare.min_height_type, data->rare.min_height); }
+		MinHeight         max_height()                 const { return LengthPercentage(data->rare.max_height_type, data->rare.max_height); }
+		VerticalAlign     vertical_align()             const { return VerticalAlign(data->rare.vertical_align_type, data->rare.vertical_align_length); }
 		const             AnimationList* animation()   const;
 		const             TransitionList* transition() const;
-		float             perspective()                const { return rare.perspective; }
-		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(rare.perspective_origin_x_type, rare.perspective_origin_x); }
-		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(rare.perspective_origin_y_type, rare.perspective_origin_y); }
+		float             perspective()                const { return data->rare.perspective; }
+		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(data->rare.perspective_origin_x_type, data->rare.perspective_origin_x); }
+		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(data->rare.perspective_origin_y_type, data->rare.perspective_origin_y); }
 		TransformPtr      transform()                  const { return GetLocalProperty(PropertyId::Transform, TransformPtr()); }
-		TransformOrigin   transform_origin_x()         const { return LengthPercentage(rare.transform_origin_x_type, rare.transform_origin_x); }
-		TransformOrigin   transform_origin_y()         const { return LengthPercentage(rare.transform_origin_y_type, rare.transform_origin_y); }
-		float             transform_origin_z()         const { return rare.transform_origin_z; }
+		TransformOrigin   transform_origin_x()         const { return LengthPercentage(data->rare.transform_origin_x_type, data->rare.transform_origin_x); }
+		TransformOrigin   transform_origin_y()         const { return LengthPercentage(data->rare.transform_origin_y_type, data->rare.transform_origin_y); }
+		float             transform_origin_z()         const { return data->rare.transform_origin_z; }
 		AlignContent      align_content()              const { return GetLocalPropertyKeyword(PropertyId::AlignContent, AlignContent::Stretch); }
 		AlignItems        align_items()                const { return GetLocalPropertyKeyword(PropertyId::AlignItems, AlignItems::Stretch); }
 		AlignSelf         align_self()                 const { return GetLocalPropertyKeyword(PropertyId::AlignSelf, AlignSelf::Auto); }
@@ -275,104 +275,118 @@ namespace Style {
 		JustifyContent    justify_content()            const { return GetLocalPropertyKeyword(PropertyId::JustifyContent, JustifyContent::FlexStart); }
 		float             flex_grow()                  const { return GetLocalProperty(PropertyId::FlexGrow, 0.f); }
 		float             flex_shrink()                const { return GetLocalProperty(PropertyId::FlexShrink, 1.f); }
-		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(rare.flex_basis_type, rare.flex_basis); }
-		float             border_top_left_radius()     const { return (float)rare.border_top_left_radius; }
-		float             border_top_right_radius()    const { return (float)rare.border_top_right_radius; }
-		float             border_bottom_right_radius() const { return (float)rare.border_bottom_right_radius; }
-		float             border_bottom_left_radius()  const { return (float)rare.border_bottom_left_radius; }
-		Clip              clip()                       const { return rare.clip; }
-		Drag              drag()                       const { return rare.drag; }
-		TabIndex          tab_index()                  const { return rare.tab_index; }
-		Colourb           image_color()                const { return rare.image_color; }
-		LengthPercentage  row_gap()                    const { return LengthPercentage(rare.row_gap_type, rare.row_gap); }
-		LengthPercentage  column_gap()                 const { return LengthPercentage(rare.column_gap_type, rare.column_gap); }
-		float             scrollbar_margin()           const { return rare.scrollbar_margin; }
+		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(data->rare.flex_basis_type, data->rare.flex_basis); }
+		float             border_top_left_radius()     const { return (float)data->rare.border_top_left_radius; }
+		float             border_top_right_radius()    const { return (float)data->rare.border_top_right_radius; }
+		float             border_bottom_right_radius() const { return (float)data->rare.border_bottom_right_radius; }
+		float             border_bottom_left_radius()  const { return (float)data->rare.border_bottom_left_radius; }
+		Clip              clip()                       const { return data->rare.clip; }
+		Drag              drag()                       const { return data->rare.drag; }
+		TabIndex          tab_index()                  const { return data->rare.tab_index; }
+		Colourb           image_color()                const { return data->rare.image_color; }
+		LengthPercentage  row_gap()                    const { return LengthPercentage(data->rare.row_gap_type, data->rare.row_gap); }
+		LengthPercentage  column_gap()                 const { return LengthPercentage(data->rare.column_gap_type, data->rare.column_gap); }
+		float             scrollbar_margin()           const { return data->rare.scrollbar_margin; }
 		
 		// -- Assignment --
 		// Common
-		void width              (LengthPercentageAuto value) { common.width_type          = value.type; common.width_value          = value.value; }
-		void height             (LengthPercentageAuto value) { common.height_type         = value.type; common.height_value         = value.value; }
-		void margin_top         (LengthPercentageAuto value) { common.margin_top_type     = value.type; common.margin_top_value     = value.value; }
-		void margin_right       (LengthPercentageAuto value) { common.margin_right_type   = value.type; common.margin_right_value   = value.value; }
-		void margin_bottom      (LengthPercentageAuto value) { common.margin_bottom_type  = value.type; common.margin_bottom_value  = value.value; }
-		void margin_left        (LengthPercentageAuto value) { common.margin_left_type    = value.type; common.margin_left_value    = value.value; }
-		void padding_top        (LengthPercentage value)     { common.padding_top_type    = value.type; common.padding_top_value    = value.value; }
-		void padding_right      (LengthPercentage value)     { common.padding_right_type  = value.type; common.padding_right_value  = value.value; }
-		void padding_bottom     (LengthPercentage value)     { common.padding_bottom_type = value.type; common.padding_bottom_value = value.value; }
-		void padding_left       (LengthPercentage value)     { common.padding_left_type   = value.type; common.padding_left_value   = value.value; }
-		void top                (LengthPercentageAuto value) { common.top_type            = value.type; common.top_value            = value.value; }
-		void right              (LengthPercentageAuto value) { common.right_type          = value.type; common.right_value          = value.value; }
-		void bottom             (LengthPercentageAuto value) { common.bottom_type         = value.type; common.bottom_value         = value.value; }
-		void left               (LengthPercentageAuto value) { common.left_type           = value.type; common.left_value           = value.value; }
-		void z_index            (NumberAuto value)           { common.z_index_type        = value.type; common.z_index_value        = value.value; }
-		void border_top_width   (int16_t value)              { common.border_top_width    = value; }
-		void border_right_width (int16_t value)              { common.border_right_width  = value; }
-		void border_bottom_width(int16_t value)              { common.border_bottom_width = value; }
-		void border_left_width  (int16_t value)              { common.border_left_width   = value; }
-		void box_sizing         (BoxSizing value)            { common.box_sizing          = value; }
-		void display            (Display value)              { common.display             = value; }
-		void position           (Position value)             { common.position            = value; }
-		void float_             (Float value)                { common.float_              = value; }
-		void clear              (Clear value)                { common.clear               = value; }
-		void overflow_x         (Overflow value)             { common.overflow_x          = value; }
-		void overflow_y         (Overflow value)             { common.overflow_y          = value; }
-		void visibility         (Visibility value)           { common.visibility          = value; }
-		void background_color   (Colourb value)              { common.background_color    = value; }
-		void border_top_color   (Colourb value)              { common.border_top_color    = value; }
-		void border_right_color (Colourb value)              { common.border_right_color  = value; }
-		void border_bottom_color(Colourb value)              { common.border_bottom_color = value; }
-		void border_left_color  (Colourb value)              { common.border_left_color   = value; }
-		void has_decorator      (bool value)                 { common.has_decorator       = value; }
+		void width              (LengthPercentageAuto value) { data->common.width_type          = value.type; data->common.width_value          = value.value; }
+		void height             (LengthPercentageAuto value) { data->common.height_type         = value.type; data->common.height_value         = value.value; }
+		void margin_top         (LengthPercentageAuto value) { data->common.margin_top_type     = value.type; data->common.margin_top_value     = value.value; }
+		void margin_right       (LengthPercentageAuto value) { data->common.margin_right_type   = value.type; data->common.margin_right_value   = value.value; }
+		void margin_bottom      (LengthPercentageAuto value) { data->common.margin_bottom_type  = value.type; data->common.margin_bottom_value  = value.value; }
+		void margin_left        (LengthPercentageAuto value) { data->common.margin_left_type    = value.type; data->common.margin_left_value    = value.value; }
+		void padding_top        (LengthPercentage value)     { data->common.padding_top_type    = value.type; data->common.padding_top_value    = value.value; }
+		void padding_right      (LengthPercentage value)     { data->common.padding_right_type  = value.type; data->common.padding_right_value  = value.value; }
+		void padding_bottom     (LengthPercentage value)     { data->common.padding_bottom_type = value.type; data->common.padding_bottom_value = value.value; }
+		void padding_left       (LengthPercentage value)     { data->common.padding_left_type   = value.type; data->common.padding_left_value   = value.value; }
+		void top                (LengthPercentageAuto value) { data->common.top_type            = value.type; data->common.top_value            = value.value; }
+		void right              (LengthPercentageAuto value) { data->common.right_type          = value.type; data->common.right_value          = value.value; }
+		void bottom             (LengthPercentageAuto value) { data->common.bottom_type         = value.type; data->common.bottom_value         = value.value; }
+		void left               (LengthPercentageAuto value) { data->common.left_type           = value.type; data->common.left_value           = value.value; }
+		void z_index            (NumberAuto value)           { data->common.z_index_type        = value.type; data->common.z_index_value        = value.value; }
+		void border_top_width   (int16_t value)              { data->common.border_top_width    = value; }
+		void border_right_width (int16_t value)              { data->common.border_right_width  = value; }
+		void border_bottom_width(int16_t value)              { data->common.border_bottom_width = value; }
+		void border_left_width  (int16_t value)              { data->common.border_left_width   = value; }
+		void box_sizing         (BoxSizing value)            { data->common.box_sizing          = value; }
+		void display            (Display value)              { data->common.display             = value; }
+		void position           (Position value)             { data->common.position            = value; }
+		void float_             (Float value)                { data->common.float_              = value; }
+		void clear              (Clear value)                { data->common.clear               = value; }
+		void overflow_x         (Overflow value)             { data->common.overflow_x          = value; }
+		void overflow_y         (Overflow value)             { data->common.overflow_y          = value; }
+		void visibility         (Visibility value)           { data->common.visibility          = value; }
+		void background_color   (Colourb value)              { data->common.background_color    = value; }
+		void border_top_color   (Colourb value)              { data->common.border_top_color    = value; }
+		void border_right_color (Colourb value)              { data->common.border_right_color  = value; }
+		void border_bottom_color(Colourb value)              { data->common.border_bottom_color = value; }
+		void border_left_color  (Colourb value)              { data->common.border_left_color   = value; }
+		void has_decorator      (bool value)                 { data->common.has_decorator       = value; }
 		// Inherited
-		void font_face_handle(FontFaceHandle value) { inherited.font_face_handle = value; }
-		void font_size       (float value)          { inherited.font_size        = value; }
-		void has_font_effect (bool value)           { inherited.has_font_effect  = value; }
-		void font_style      (FontStyle value)      { inherited.font_style       = value; }
-		void font_weight     (FontWeight value)     { inherited.font_weight      = value; }
-		void pointer_events  (PointerEvents value)  { inherited.pointer_events   = value; }
-		void focus           (Focus value)          { inherited.focus            = value; }
-		void text_align      (TextAlign value)      { inherited.text_align       = value; }
-		void text_decoration (TextDecoration value) { inherited.text_decoration  = value; }
-		void text_transform  (TextTransform value)  { inherited.text_transform   = value; }
-		void white_space     (WhiteSpace value)     { inherited.white_space      = value; }
-		void word_break      (WordBreak value)      { inherited.word_break       = value; }
-		void color           (Colourb value)        { inherited.color            = value; }
-		void opacity         (float value)          { inherited.opacity          = value; }
-		void line_height     (LineHeight value)     { inherited.line_height = value.value; inherited.line_height_inherit_type = value.inherit_type; inherited.line_height_inherit = value.inherit_value;  }
+		void font_face_handle(FontFaceHandle value) { data->inherited.font_face_handle = value; }
+		void font_size       (float value)          { data->inherited.font_size        = value; }
+		void has_font_effect (bool value)           { data->inherited.has_font_effect  = value; }
+		void font_style      (FontStyle value)      { data->inherited.font_style       = value; }
+		void font_weight     (FontWeight value)     { data->inherited.font_weight      = value; }
+		void pointer_events  (PointerEvents value)  { data->inherited.pointer_events   = value; }
+		void focus           (Focus value)          { data->inherited.focus            = value; }
+		void text_align      (TextAlign value)      { data->inherited.text_align       = value; }
+		void text_decoration (TextDecoration value) { data->inherited.text_decoration  = value; }
+		void text_transform  (TextTransform value)  { data->inherited.text_transform   = value; }
+		void white_space     (WhiteSpace value)     { data->inherited.white_space      = value; }
+		void word_break      (WordBreak value)      { data->inherited.word_break       = value; }
+		void color           (Colourb value)        { data->inherited.color            = value; }
+		void opacity         (float value)          { data->inherited.opacity          = value; }
+		void line_height     (LineHeight value)     { data->inherited.line_height = value.value; data->inherited.line_height_inherit_type = value.inherit_type; data->inherited.line_height_inherit = value.inherit_value;  }
 		// Rare
-		void min_width                 (MinWidth value)          { rare.min_width_type             = value.type; rare.min_width                  = value.value; }
-		void max_width                 (MaxWidth value)          { rare.max_width_type             = value.type; rare.max_width                  = value.value; }
-		void min_height                (MinHeight value)         { rare.min_height_type            = value.type; rare.min_height                 = value.value; }
-		void max_height                (MaxHeight value)         { rare.max_height_type            = value.type; rare.max_height                 = value.value; }
-		void vertical_align            (VerticalAlign value)     { rare.vertical_align_type        = value.type; rare.vertical_align_length      = value.value; }
-		void perspective_origin_x      (PerspectiveOrigin value) { rare.perspective_origin_x_type  = value.type; rare.perspective_origin_x       = value.value; }
-		void perspective_origin_y      (PerspectiveOrigin value) { rare.perspective_origin_y_type  = value.type; rare.perspective_origin_y       = value.value; }
-		void transform_origin_x        (TransformOrigin value)   { rare.transform_origin_x_type    = value.type; rare.transform_origin_x         = value.value; }
-		void transform_origin_y        (TransformOrigin value)   { rare.transform_origin_y_type    = value.type; rare.transform_origin_y         = value.value; }
-		void row_gap                   (LengthPercentage value)  { rare.row_gap_type               = value.type; rare.row_gap                    = value.value; }
-		void column_gap                (LengthPercentage value)  { rare.column_gap_type            = value.type; rare.column_gap                 = value.value; }
-		void flex_basis                (FlexBasis value)         { rare.flex_basis_type            = value.type; rare.flex_basis                 = value.value; }
-		void transform_origin_z        (float value)             { rare.transform_origin_z         = value; }
-		void perspective               (float value)             { rare.perspective                = value; }
-		void border_top_left_radius    (float value)             { rare.border_top_left_radius     = (int16_t)value; }
-		void border_top_right_radius   (float value)             { rare.border_top_right_radius    = (int16_t)value; }
-		void border_bottom_right_radius(float value)             { rare.border_bottom_right_radius = (int16_t)value; }
-		void border_bottom_left_radius (float value)             { rare.border_bottom_left_radius  = (int16_t)value; }
-		void clip                      (Clip value)              { rare.clip                       = value; }
-		void drag                      (Drag value)              { rare.drag                       = value; }
-		void tab_index                 (TabIndex value)          { rare.tab_index                  = value; }
-		void image_color               (Colourb value)           { rare.image_color                = value; }
-		void scrollbar_margin          (float value)             { rare.scrollbar_margin           = value; }
+		void min_width                 (MinWidth value)          { data->rare.min_width_type             = value.type; data->rare.min_width                  = value.value; }
+		void max_width                 (MaxWidth value)          { data->rare.max_width_type             = value.type; data->rare.max_width                  = value.value; }
+		void min_height                (MinHeight value)         { data->rare.min_height_type            = value.type; data->rare.min_height                 = value.value; }
+		void max_height                (MaxHeight value)         { data->rare.max_height_type            = value.type; data->rare.max_height                 = value.value; }
+		void vertical_align            (VerticalAlign value)     { data->rare.vertical_align_type        = value.type; data->rare.vertical_align_length      = value.value; }
+		void perspective_origin_x      (PerspectiveOrigin value) { data->rare.perspective_origin_x_type  = value.type; data->rare.perspective_origin_x       = value.value; }
+		void perspective_origin_y      (PerspectiveOrigin value) { data->rare.perspective_origin_y_type  = value.type; data->rare.perspective_origin_y       = value.value; }
+		void transform_origin_x        (TransformOrigin value)   { data->rare.transform_origin_x_type    = value.type; data->rare.transform_origin_x         = value.value; }
+		void transform_origin_y        (TransformOrigin value)   { data->rare.transform_origin_y_type    = value.type; data->rare.transform_origin_y         = value.value; }
+		void row_gap                   (LengthPercentage value)  { data->rare.row_gap_type               = value.type; data->rare.row_gap                    = value.value; }
+		void column_gap                (LengthPercentage value)  { data->rare.column_gap_type            = value.type; data->rare.column_gap                 = value.value; }
+		void flex_basis                (FlexBasis value)         { data->rare.flex_basis_type            = value.type; data->rare.flex_basis                 = value.value; }
+		void transform_origin_z        (float value)             { data->rare.transform_origin_z         = value; }
+		void perspective               (float value)             { data->rare.perspective                = value; }
+		void border_top_left_radius    (float value)             { data->rare.border_top_left_radius     = (int16_t)value; }
+		void border_top_right_radius   (float value)             { data->rare.border_top_right_radius    = (int16_t)value; }
+		void border_bottom_right_radius(float value)             { data->rare.border_bottom_right_radius = (int16_t)value; }
+		void border_bottom_left_radius (float value)             { data->rare.border_bottom_left_radius  = (int16_t)value; }
+		void clip                      (Clip value)              { data->rare.clip                       = value; }
+		void drag                      (Drag value)              { data->rare.drag                       = value; }
+		void tab_index                 (TabIndex value)          { data->rare.tab_index                  = value; }
+		void image_color               (Colourb value)           { data->rare.image_color                = value; }
+		void scrollbar_margin          (float value)             { data->rare.scrollbar_margin           = value; }
 
 		// clang-format on
 
 		// -- Management --
 		void CopyNonInherited(const ComputedValues& other)
 		{
-			common = other.common;
-			rare = other.rare;
+			data->common = other.data->common;
+			data->rare = other.data->rare;
+		}
+		void CopyInherited(const ComputedValues& parent) { data->inherited = parent.data->inherited; }
+
+		// -- Sharing --
+		/// Returns true if the underlying values are shared with another element.
+		bool IsShared() const { return data.use_count() > 1; }
+		/// Returns true if the underlying values are the same as those of the other element.
+		bool IsSharedWith(const ComputedValues& other) const { return data == other.data; }
+		/// Reference the values of another element, they must not be modified before calling EnsureUnique().
+		void ShareWith(const ComputedValues& other) { data = other.data; }
+		/// Makes a private copy of the values if they are currently shared, must be called before any modification.
+		void EnsureUnique()
+		{
+			if (IsShared())
+				data = MakeShared<Data>(*data);
 		}
-		void CopyInherited(const ComputedValues& parent) { inherited = parent.inherited; }
 
 	private:
 		template <typename T>
@@ -390,11 +404,15 @@ namespace Style {
 			return default_value;
 		}
 
-		Element* element = nullptr;
+		struct Data
+		{
+			CommonValues common;
+			InheritedValues inherited;
+			RareValues rare;
+		};
 
-		CommonValues common;
-		InheritedValues inherited;
-		RareValues rare;
+		Element* element = nullptr;
+		SharedPtr<Data> data;
 	};
 
 } // namespace Style
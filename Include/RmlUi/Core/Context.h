@@ -42,6 +42,10 @@ class ContextInstancer;
 class ElementDocument;
 class EventListener;
 class RenderInterface;
+class RenderCommandList;
+class ElementUtilities;
+class Geometry;
+class HitTestGrid;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
@@ -87,6 +91,35 @@ public:
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Enables or disables render batching. When enabled, rendering first records a list of render commands, where consecutive geometry
+	/// sharing the same texture, transform, and scissor state is merged. The merged geometry is then submitted through
+	/// RenderInterface::RenderBatchedGeometry(), instead of one draw call for each piece of geometry. The recorded commands are retained,
+	/// and replayed without visiting the element tree when nothing has changed since the previous render, see IsRenderDirty().
+	/// @note While enabled, custom elements should render through Geometry objects. Any direct calls to the render interface during
+	/// rendering are not ordered with the batched geometry. Elements which change their rendering on their own should call
+	/// Element::DirtyUpdate() from Element::OnUpdate().
+	/// @param[in] enable True to enable render batching, false to disable.
+	void SetRenderBatching(bool enable);
+	/// Returns true if render batching is enabled.
+	bool GetRenderBatching() const;
+	/// Returns true if anything may render differently since the last call to Render(). Changes are detected during Update(), thus this
+	/// should be called after updating the context. Applications can skip rendering the context and reuse its previous output when false.
+	bool IsRenderDirty() const;
+
+	/// Returns the number of elements visited during the last call to Update().
+	/// @note Elements are only visited when they or any of their descendants have changed since the previous update.
+	int GetNumUpdatedElements() const;
+	/// Returns the number of elements formatted by the layout engine during the last call to Update().
+	/// @note Only the contents of the nearest layout boundary are formatted when possible, instead of the whole document.
+	int GetNumFormattedElements() const;
+	/// Returns the number of style sheet nodes rejected by the ancestor filter during the last call to Update().
+	/// @note These nodes require the presence of names in the element's ancestors which were quickly determined to be missing.
+	int GetNumRejectedStyleNodes() const;
+	/// Returns the number of style sheet nodes which required walking up the element hierarchy to match during the last call to Update().
+	int GetNumTraversedStyleNodes() const;
+	/// Returns the number of geometry batches submitted during the last call to Render(), when render batching is enabled.
+	int GetNumRenderBatches() const;
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
 	/// @return The new document, or nullptr if no document could be created.
@@ -281,6 +314,26 @@ private:
 	float density_independent_pixel_ratio;
 	String documents_base_tag = "body";
 
+	int num_updated_elements = 0;
+	int num_formatted_elements = 0;
+	int num_rejected_style_nodes = 0;
+	int num_traversed_style_nodes = 0;
+	int num_render_batches = 0;
+
+	// Set when anything may render differently since the last render.
+	bool render_dirty = true;
+	int render_texture_change_counter = 0;
+
+	// Advanced whenever the geometry or style of any element may have changed, such as by layout, offsets, scrolling, and transforms, and
+	// whenever an element is detached.
+	uint64_t geometry_generation = 1;
+
+	// The hit test grid accelerates repeated calls to GetElementAtPoint(). It is only rebuilt once the same geometry generation is hit
+	// tested again, so that continuously changing documents don't pay for it.
+	mutable UniquePtr<HitTestGrid> hit_test_grid;
+	mutable uint64_t hit_test_grid_generation = 0;
+	mutable uint64_t hit_test_search_generation = 0;
+
 	SmallUnorderedSet<String> active_themes;
 
 	ContextInstancer* instancer;
@@ -346,11 +399,26 @@ private:
 	// itself can't be part of it.
 	ElementSet drag_hover_chain;
 
+	// Storage retained between updates of the hover chain to avoid allocations on mouse movement. Taken by each update while in
+	// use, so that recursive updates from within event listeners use their own storage.
+	ElementSet spare_hover_chain, spare_drag_hover_chain;
+	Dictionary spare_parameters, spare_drag_parameters;
+
+	// The mouse position and geometry generation of the last hover chain update, or zero to update it on the next context update.
+	Vector2i hover_chain_mouse_position;
+	uint64_t hover_chain_generation = 0;
+
 	// The render interface this context renders through.
 	RenderInterface* render_interface;
+	// True if the render interface applies colour multipliers when rendering compiled geometry, queried once on creation.
+	bool render_colour_multiplier = false;
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	// Render commands of the current frame when batching is enabled, only active during rendering.
+	UniquePtr<RenderCommandList> render_commands;
+	RenderCommandList* active_render_commands = nullptr;
+
 	using DataModels = UnorderedMap<String, UniquePtr<DataModel>>;
 	DataModels data_models;
 
@@ -400,6 +468,8 @@ private:
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::ElementUtilities;
+	friend class Rml::Geometry;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
@@ -136,6 +136,29 @@ RMLUICORE_API bool LoadFontFace(const String& file_path, bool fallback_face = fa
 /// @lifetime The pointed to 'data' must remain available until after the call to Rml::Shutdown.
 RMLUICORE_API bool LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style,
 	Style::FontWeight weight = Style::FontWeight::Auto, bool fallback_face = false);
+/// Enables distance field font rendering in the default font engine. Glyphs are then rasterized once for each font face and rendered at any
+/// size by scaling their distance fields, instead of generating glyph textures for every font size in use. Requires a render interface
+/// supporting distance field textures. Faces with colour glyphs, and font effects, still use textures generated for each size.
+/// @param[in] enable True to enable distance field font rendering.
+/// @note Applies to font sizes used for the first time after the call. Call ReleaseFontResources() to apply it to existing text.
+/// @note Disabled again by Shutdown().
+RMLUICORE_API void SetFontDistanceFieldRendering(bool enable);
+/// Loads a font cache file previously written by SaveFontCache(), through the file interface. Font sizes used from now on are then
+/// restored from the cache when available, without rasterizing their glyphs or rendering their font effects.
+/// @param[in] file_path The path to the font cache file.
+/// @return True if the cache was loaded, false if the file could not be read or was written by a different version of RmlUi.
+/// @note Only supported by the default font engine. Must be called after initialisation.
+RMLUICORE_API bool LoadFontCache(const String& file_path);
+/// Writes the glyphs, kerning, and font effect textures of all font sizes currently in use to a font cache file, along with any unused
+/// entries from a previously loaded cache. The cache is identified by the data of each font face, thus remains valid for the same fonts.
+/// @param[in] file_path The path to the font cache file, written with the standard C file functions.
+/// @return True on success.
+/// @note Only supported by the default font engine.
+RMLUICORE_API bool SaveFontCache(const String& file_path);
+/// Returns the memory used by the default font engine to cache the kerning of character pairs for a font face handle.
+/// @param[in] handle A font face handle, such as returned by Element::GetFontFaceHandle().
+/// @return The number of bytes used by the kerning cache, or zero if the handle is not from the default font engine.
+RMLUICORE_API size_t GetFontKerningCacheMemoryUsage(FontFaceHandle handle);
 
 /// Registers a generic RmlUi plugin.
 RMLUICORE_API void RegisterPlugin(Plugin* plugin);
@@ -45,8 +45,16 @@ class RMLUICORE_API DataModelHandle {
 public:
 	DataModelHandle(DataModel* model = nullptr);
 
+	// Returns true if the variable or any part of it has been dirtied.
 	bool IsVariableDirty(const String& variable_name);
-	void DirtyVariable(const String& variable_name);
+	// Dirty a variable so that any views depending on it are updated. Either give the name of a top-level variable, or the address of a
+	// part of it, such as 'inventory[42].count'. In the latter case, only views depending on the address, or any of its parents or
+	// children, are updated. Thus, when values of other members are derived from the changed value, dirty their common parent instead.
+	void DirtyVariable(const String& variable_name_or_address);
+	// Dirty only the structure of an array variable, after entries have been inserted, removed, or moved without changing their values.
+	// Then, views depending on the array itself or its size are updated, but not the views of its entries. Keyed data-for rows are
+	// moved along with their entries without updating their views, while rows matched by index are updated with their new entries.
+	void DirtyVariableStructure(const String& variable_name_or_address);
 	void DirtyAllVariables();
 
 	explicit operator bool() { return model; }
@@ -125,6 +133,11 @@ public:
 		type_register->GetTransformFuncRegister()->Register(name, std::move(transform_func));
 	}
 
+	// Allows the expressions of this model's data views to be evaluated on worker threads during large updates, see SystemInterface::RunParallelTasks().
+	// @note Only enable this when all get functions and transform functions used by the model can safely be called concurrently.
+	// @note Disabled by default.
+	void SetParallelEvaluation(bool enable);
+
 	// Returns the type register.
 	// The type register contains VariableDefinitions of all the data types registered to this data model's owning context.
 	DataTypeRegister* GetDataTypeRegister() const { return type_register; }
@@ -60,6 +60,11 @@ public:
 	DataVariable Child(const DataAddressEntry& address);
 	DataVariableType Type();
 
+	// Returns the definition of the struct member with the given name, or nullptr if this is not a struct or the member is not found.
+	VariableDefinition* MemberDefinition(const String& name);
+	// Equivalent to Child() with the name of the given member definition, but without looking up the member by name.
+	DataVariable Member(VariableDefinition* member_definition);
+
 private:
 	VariableDefinition* definition = nullptr;
 	void* ptr = nullptr;
@@ -83,6 +88,9 @@ public:
 	virtual int Size(void* ptr);
 	virtual DataVariable Child(void* ptr, const DataAddressEntry& address);
 
+	virtual VariableDefinition* MemberDefinition(const String& name);
+	virtual DataVariable Member(void* ptr, VariableDefinition* member_definition);
+
 protected:
 	VariableDefinition(DataVariableType type) : type(type) {}
 
@@ -156,6 +164,9 @@ public:
 
 	DataVariable Child(void* ptr, const DataAddressEntry& address) override;
 
+	VariableDefinition* MemberDefinition(const String& name) override;
+	DataVariable Member(void* ptr, VariableDefinition* member_definition) override;
+
 	void AddMember(const String& name, UniquePtr<VariableDefinition> member);
 
 private:
@@ -209,6 +220,9 @@ public:
 	int Size(void* ptr) override;
 	DataVariable Child(void* ptr, const DataAddressEntry& address) override;
 
+	VariableDefinition* MemberDefinition(const String& name) override;
+	DataVariable Member(void* ptr, VariableDefinition* member_definition) override;
+
 protected:
 	virtual void* DereferencePointer(void* ptr) = 0;
 
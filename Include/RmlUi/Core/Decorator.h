@@ -66,6 +66,10 @@ public:
 	/// @param[in] element_data The handle to the data generated by the decorator for the element.
 	virtual void RenderElement(Element* element, DecoratorDataHandle element_data) const = 0;
 
+	/// Returns true if the generated element data depends on the opacity of the element, then it is generated again whenever the opacity
+	/// changes. Decorators which instead apply the opacity when rendering, such as through a geometry colour multiplier, can return false.
+	virtual bool IsOpacityDependent() const;
+
 	/// Value specifying an invalid or non-existent Decorator data handle.
 	static const DecoratorDataHandle INVALID_DECORATORDATAHANDLE = 0;
 
@@ -46,6 +46,7 @@ namespace Rml {
 class Context;
 class DataModel;
 class Decorator;
+class ElementAccess;
 class ElementInstancer;
 class EventDispatcher;
 class EventListener;
@@ -54,6 +55,7 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class HitTestGrid;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
@@ -190,6 +192,7 @@ public:
 	/// Checks if a given point in screen coordinates lies within the bordered area of this element.
 	/// @param[in] point The point to test.
 	/// @return True if the element is within this element, false otherwise.
+	/// @note Context hit testing only considers elements for points within the bounds of their boxes, or anywhere if they are transformed.
 	virtual bool IsPointWithinElement(Vector2f point);
 
 	/// Returns the visibility of the element.
@@ -605,8 +608,14 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Marks the element as needing an update during the next context update. Clean subtrees are skipped by the update loop, thus
+	/// elements that need OnUpdate() to be called on every frame should call this function from within OnUpdate().
+	void DirtyUpdate();
+
 protected:
-	void Update(float dp_ratio, Vector2f vp_dimensions);
+	/// Updates this element and all descendants marked as needing an update.
+	/// @return The number of elements visited.
+	int Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
 
 	/// Updates definition, computed values, and runs OnPropertyChange on this element.
@@ -615,7 +624,8 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated, only on elements marked as needing an update.
+	/// @see DirtyUpdate()
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -673,9 +683,16 @@ protected:
 
 private:
 	void SetParent(Element* parent);
+
+	// Rearranges the given children among the positions they occupy, so that they appear in the given order. Unlike removing
+	// and inserting them again, the children stay attached to the document and its data model.
+	void ReorderChildren(const ElementList& ordered_children);
 	
 	void SetDataModel(DataModel* new_data_model);
 
+	/// Dirties the layout due to changes in the element's own box.
+	void DirtyLayoutFromParent();
+
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
 	void UpdateOffset();
@@ -685,8 +702,15 @@ private:
 	void BuildStackingContext(ElementList* stacking_context);
 	static void BuildStackingContextForTable(Vector<StackingOrderedChild>& ordered_children, Element* child);
 	void DirtyStackingContext();
+	/// Notifies the context that the rendered output may have changed.
+	void DirtyRender();
 
 	void UpdateDefinition();
+	void UpdateDefinitionRecursive();
+	Element* FindStyleSharingElement() const;
+	void UpdateChildDefinitionsParallel();
+
+	void DirtyUpdateAncestors();
 
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
@@ -733,6 +757,9 @@ private:
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
+	bool dirty_update : 1; // This element needs to be visited during the update loop.
+	bool dirty_descendant_update : 1; // At least one descendant has 'dirty_update' set.
+
 	OwnedElementList children;
 	int num_non_dom_children;
 
@@ -795,7 +822,9 @@ private:
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::ElementAccess;
 	friend class Rml::ElementStyle;
+	friend class Rml::HitTestGrid;
 	friend class Rml::LayoutEngine;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
@@ -160,6 +160,8 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Sets the dirty flag on a layout boundary so that only its contents will be formatted before the next render.
+	void DirtyLayoutBoundary(Element* element);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -170,6 +172,11 @@ private:
 	/// Updates the layout if necessary.
 	void UpdateLayout();
 
+	/// Queues a resize event for an element resized during layout.
+	void AddResizedElement(Element* element);
+	/// Dispatches the resize events of the elements resized during layout.
+	void DispatchResizeEvents();
+
 	/// Updates the position of the document based on the style properties.
 	void UpdatePosition();
 	/// Sets the dirty flag for document positioning
@@ -191,10 +198,15 @@ private:
 
 	// Is the layout dirty?
 	bool layout_dirty;
+	// Layout boundaries in need of formatting, only used when the layout of the document itself is clean.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
+	// Elements listening for resize events which were resized during layout.
+	Vector<ObserverPtr<Element>> resized_elements;
 
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 
 };
@@ -103,6 +103,9 @@ private:
 	void GenerateGeometry(const FontFaceHandle font_face_handle);
 	// Generates the geometry for a single line of text.
 	void GenerateGeometry(const FontFaceHandle font_face_handle, Line& line);
+	// Re-colours the vertices of the text geometry from the previous colour to the current colour, without generating it again.
+	// Returns false if the geometry must be generated again instead, such as when rendered with font effects.
+	bool RecolourGeometry(Colourb previous_colour);
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(const FontFaceHandle font_face_handle);
 
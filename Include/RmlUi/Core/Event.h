@@ -39,6 +39,7 @@ namespace Rml {
 class Factory;
 class Element;
 class EventInstancer;
+class EventInstancerDefault;
 struct EventSpecification;
 
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
@@ -124,6 +125,9 @@ protected:
 	Element* current_element = nullptr;
 
 private:
+	/// Initialize the event state, also used to reuse a previously released event while retaining its storage.
+	void Initialize(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+
 	/// Project the mouse coordinates to the current element to enable
 	/// interacting with transformed elements.
 	void ProjectMouse(Element* element);
@@ -146,6 +150,7 @@ private:
 	EventInstancer* instancer = nullptr;
 
 	friend class Rml::Factory;
+	friend class Rml::EventInstancerDefault;
 };
 
 
@@ -82,6 +82,14 @@ public:
 	/// Sets the geometry's texture.
 	void SetTexture(const Texture* texture);
 
+	/// Sets a colour to multiply the colour of every vertex by when rendered, without modifying the vertices. If supported by the render
+	/// interface, this is applied when rendering the compiled geometry, otherwise the geometry is compiled again with multiplied colours.
+	/// @param[in] colour_multiplier The colour multiplier, component-wise with each component normalized to [0, 1].
+	void SetColourMultiplier(Colourb colour_multiplier);
+	/// Gets the colour multiplier applied to the vertex colours when rendered.
+	/// @return The colour multiplier.
+	Colourb GetColourMultiplier() const;
+
 	/// Releases any previously-compiled geometry, and forces any new geometry to have a compile attempted.
 	/// @param[in] clear_buffers True to also clear the vertex and index buffers, false to leave intact.
 	void Release(bool clear_buffers = false);
@@ -93,6 +101,9 @@ private:
 	// Move members from another geometry.
 	void MoveFrom(Geometry& other) noexcept;
 
+	// Render the compiled geometry, applying the colour multiplier if the render interface supports it.
+	void RenderCompiled(RenderInterface* render_interface, Vector2f translation, bool render_colour_multiplier);
+
 	// Returns the host context's render interface.
 	RenderInterface* GetRenderInterface();
 
@@ -102,8 +113,14 @@ private:
 	Vector< Vertex > vertices;
 	Vector< int > indices;
 	const Texture* texture = nullptr;
+	Colourb colour_multiplier = Colourb(255);
 
 	CompiledGeometryHandle compiled_geometry = 0;
+	TextureHandle compiled_texture = 0;
+	// The colour multiplier applied to the vertices of the compiled geometry, when not supported by the render interface.
+	Colourb compiled_colour_multiplier = Colourb(255);
+	// The vertices multiplied by the compiled colour multiplier, kept for rendering in immediate mode when the geometry could not be compiled.
+	Vector< Vertex > multiplied_vertices;
 	bool compile_attempted = false;
 
 	GeometryDatabaseHandle database_handle;
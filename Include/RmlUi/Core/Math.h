@@ -92,6 +92,9 @@ RMLUICORE_API Vector2f Min<Vector2f>(Vector2f a, Vector2f b);
 /// Color interpolation.
 RMLUICORE_API Colourb RoundedLerp(float t, Colourb c0, Colourb c1);
 
+/// Color multiplication, component-wise with each component normalized to [0, 1].
+RMLUICORE_API Colourb MultiplyColour(Colourb c0, Colourb c1);
+
 /// Evaluates if a number is, or close to, zero.
 /// @param[in] value The number to compare to zero.
 /// @return True if the number if zero or close to it, false otherwise.
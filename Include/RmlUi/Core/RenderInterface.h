@@ -76,10 +76,31 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to render.
 	/// @param[in] translation The translation to apply to the geometry.
 	virtual void RenderCompiledGeometry(CompiledGeometryHandle geometry, const Vector2f& translation);
+	/// Called by RmlUi to query whether the render interface can render compiled geometry with a colour multiplier, through
+	/// RenderCompiledGeometryWithColour(). Then, changing the opacity of geometry does not require it to be compiled again.
+	/// @return True if colour multipliers are supported, false if not.
+	virtual bool SupportsColourMultiplier();
+	/// Called by RmlUi when it wants to render application-compiled geometry with the colour of each of its vertices multiplied by the
+	/// given colour, component-wise with each component normalized to [0, 1]. Only called when SupportsColourMultiplier() returns true.
+	/// @param[in] geometry The application-specific compiled geometry to render.
+	/// @param[in] translation The translation to apply to the geometry.
+	/// @param[in] colour_multiplier The colour to multiply the vertex colours by.
+	virtual void RenderCompiledGeometryWithColour(CompiledGeometryHandle geometry, const Vector2f& translation, const Colourb& colour_multiplier);
 	/// Called by RmlUi when it wants to release application-compiled geometry.
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 
+	/// Called by RmlUi when it wants to render a batch of geometry merged from multiple draw calls. This is only called for contexts with
+	/// render batching enabled, see Context::SetRenderBatching(). All the geometry in a batch shares the same texture, transform, and scissor
+	/// state, and the translation has already been applied to the vertices. The data is only valid for the duration of the call.
+	/// If not overridden, the batch is rendered through RenderGeometry() instead.
+	/// @param[in] vertices The batch's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function.
+	/// @param[in] indices The batch's index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	virtual void RenderBatchedGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -102,6 +123,34 @@ public:
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi to query whether the render interface can update regions of generated textures through UpdateTexture(). If not
+	/// overridden or false is returned, textures are released and generated again in full whenever their contents change.
+	/// @return True if UpdateTexture() is supported, false if not.
+	virtual bool SupportsTextureUpdates();
+	/// Called by RmlUi when it wants to update a region of a texture previously generated by GenerateTexture(). This is only called when
+	/// SupportsTextureUpdates() returns true. The region is always contained within the texture's dimensions.
+	/// @param[in] texture_handle The handle of the texture to update.
+	/// @param[in] region_offset The top-left corner, in pixels, of the region to update.
+	/// @param[in] region_dimensions The dimensions, in pixels, of the region to update.
+	/// @param[in] source The raw 8-bit texture data of the region, starting at its top-left pixel, in the same format as for GenerateTexture().
+	/// @param[in] source_stride The number of bytes between the start of each row in the source data.
+	/// @return True if the texture was updated, false if not in which case the texture is released and generated again.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const Vector2i& region_offset, const Vector2i& region_dimensions, const byte* source,
+		int source_stride);
+	/// Called by RmlUi to query whether the render interface can render distance field textures generated by GenerateDistanceFieldTexture().
+	/// This is required for distance field font rendering, otherwise text is rendered from regular textures.
+	/// @return True if distance field textures are supported, false if not.
+	virtual bool SupportsDistanceFieldTextures();
+	/// Called by RmlUi when a distance field texture is required, such as for distance field font rendering. Only called when
+	/// SupportsDistanceFieldTextures() returns true. The alpha channel encodes the distance to the edge of a shape, where 0.5 is on the edge
+	/// and increasing values are further inside. Geometry with this texture should be rendered with the vertex colour, with its opacity
+	/// given by smoothly thresholding the sampled alpha value at 0.5 over about a pixel on screen. Regions are updated through
+	/// UpdateTexture() in the same way as other generated textures.
+	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
+	/// @param[in] source The raw 8-bit texture data, in the same format as for GenerateTexture().
+	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
+	/// @return True if the texture generation succeeded and the handle is valid, false if not.
+	virtual bool GenerateDistanceFieldTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
@@ -43,6 +43,7 @@ class Decorator;
 class SpritesheetList;
 class StyleSheetContainer;
 class StyleSheetParser;
+struct ElementDefinitionCache;
 struct PropertySource;
 struct Sprite;
 
@@ -110,9 +111,8 @@ private:
 	// Map of all styled nodes, that is, they have one or more properties.
 	StyleSheetIndex styled_node_index;
 
-	// Index of node sets to element definitions.
-	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
-	mutable ElementDefinitionCache node_cache;
+	// Index of node sets to element definitions, safe to access from multiple threads.
+	UniquePtr<ElementDefinitionCache> node_cache;
 
 	// Cached decorator instances.
 	using DecoratorCache = UnorderedMap<String, Vector<SharedPtr<const Decorator>>>;
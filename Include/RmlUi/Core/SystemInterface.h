@@ -98,6 +98,18 @@ public:
 	
 	/// Deactivate keyboard (for touchscreen devices).
 	virtual void DeactivateKeyboard();
+
+	/// Get the number of worker threads available for running tasks in parallel.
+	/// @return The number of worker threads. Zero by default, which disables all parallel work in the library.
+	virtual int GetNumWorkerThreads();
+
+	/// Run a task once for each index in the range [0, num_tasks), possibly in parallel on worker threads.
+	/// @param[in] num_tasks The number of tasks to run.
+	/// @param[in] task The task to run, taking the index of the task as argument.
+	/// @note This function must not return before all the tasks have completed. The default implementation runs all the tasks on the calling thread.
+	/// @note Only called when GetNumWorkerThreads() returns a value larger than zero. The tasks may call GetElapsedTime() concurrently.
+	/// @note The tasks may evaluate data view expressions of data models enabled through DataModelConstructor::SetParallelEvaluation(), then any get functions and transform functions used by those models may be called concurrently, as well as LogMessage() on evaluation errors.
+	virtual void RunParallelTasks(int num_tasks, const Function<void(int)>& task);
 };
 
 } // namespace Rml
@@ -64,7 +64,17 @@ public:
 	/// Set a callback function for generating the texture on first use. The texture is never added to the global cache.
 	/// @param[in] name The name of the texture.
 	/// @param[in] callback The callback function which generates the data of the texture, see TextureCallback.
-	void Set(const String& name, const TextureCallback& callback);
+	/// @param[in] distance_field True to generate the texture as a distance field texture, see RenderInterface::GenerateDistanceFieldTexture().
+	void Set(const String& name, const TextureCallback& callback, bool distance_field = false);
+
+	/// Updates a region of a texture set from a callback function. Render interfaces which already hold the texture have the region
+	/// updated in place when supported, otherwise the texture is released and generated again by the callback on next use. Thus, the
+	/// callback function should generate the updated contents from now on.
+	/// @param[in] region_offset The top-left corner, in pixels, of the region to update.
+	/// @param[in] region_dimensions The dimensions, in pixels, of the region to update.
+	/// @param[in] source The raw data of the region starting at its top-left pixel, each pixel has four 8-bit channels: red-green-blue-alpha.
+	/// @param[in] source_stride The number of bytes between the start of each row in the source data.
+	void Update(Vector2i region_offset, Vector2i region_dimensions, const byte* source, int source_stride);
 
 	/// Returns the texture's source name. This is usually the name of the file the texture was loaded from.
 	/// @return The name of the this texture's source. This will be the empty string if this texture is not loaded.
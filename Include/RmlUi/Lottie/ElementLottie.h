@@ -50,6 +50,9 @@ public:
 	bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio) override;
 
 protected:
+	/// Advances the animation, and keeps the element updating while it is playing.
+	void OnUpdate() override;
+
 	/// Renders the animation.
 	void OnRender() override;
 
@@ -69,8 +72,12 @@ private:
 	void GenerateGeometry();
 	// Loads the element's animation, as specified by the 'src' attribute.
 	bool LoadAnimation();
-	// Update the texture for the next animation frame when necessary.
+	// Finds the animation frame to display at the current time.
+	void AdvanceAnimation();
+	// Update the texture for the current animation frame when necessary.
 	void UpdateTexture();
+	// Renders the given animation frame into the texture data, which must be large enough for the render dimensions.
+	void RenderAnimationFrame(byte* p_data, size_t frame);
 
 	bool animation_dirty = false;
 	bool geometry_dirty = false;
@@ -89,6 +96,8 @@ private:
 
 	// The absolute time when the current animation was first displayed.
 	double time_animation_start = -1;
+	// The animation frame to display, advanced during update.
+	size_t animation_frame = 0;
 	// The previous animation frame displayed.
 	size_t prev_animation_frame = size_t(-1);
 
@@ -83,6 +83,8 @@ private:
 	Vector2f intrinsic_dimensions;
 	// The element's size for rendering.
 	Vector2i render_dimensions;
+	// The size of the currently generated texture.
+	Vector2i texture_dimensions;
 
 	// The geometry used to render this element.
 	Geometry geometry;
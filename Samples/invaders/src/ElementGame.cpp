@@ -90,6 +90,9 @@ void ElementGame::ProcessEvent(Rml::Event& event)
 void ElementGame::OnUpdate()
 {
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
+
+	// Keep the game running on every frame.
+	DirtyUpdate();
 }
 
 // Renders the game.
@@ -85,6 +85,9 @@ void ElementGame::OnUpdate()
 {
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
 
+	// Keep the game running on every frame.
+	DirtyUpdate();
+
 	if (game->IsGameOver())
 		DispatchEvent("gameover", Rml::Dictionary());
 }
@@ -0,0 +1,165 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "ElementStyle.h"
+#include <atomic>
+
+namespace Rml {
+
+enum class AncestorNameType : uint32_t { Tag, Id, Class };
+
+static std::atomic<int> num_rejected_nodes(0);
+static std::atomic<int> num_traversed_nodes(0);
+
+static inline uint32_t HashName(Atom atom, AncestorNameType type)
+{
+	// Mix the small, sequential atom identifiers across all the bits, the two counter indices are taken from separate bits of the hash.
+	uint32_t hash = (uint32_t(atom) << 2) | uint32_t(type);
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+AncestorFilter& AncestorFilter::Get()
+{
+	static thread_local AncestorFilter filter;
+	return filter;
+}
+
+void AncestorFilter::Push(const Element* element)
+{
+	const ElementStyle* style = element->GetStyle();
+
+	const size_t hashes_begin = hashes.size();
+	AddHashes(hashes, style->GetTagAtom(), style->GetIdAtom(), style->GetClassAtoms());
+
+	for (size_t i = hashes_begin; i < hashes.size(); i++)
+		Increment(hashes[i]);
+
+	entries.push_back(Entry{element, hashes_begin});
+}
+
+void AncestorFilter::Pop(const Element* element)
+{
+	RMLUI_ASSERT(!entries.empty() && entries.back().element == element);
+	(void)element;
+
+	// The element's names may have changed since it was pushed, so make sure to remove the same hashes as we added.
+	const size_t hashes_begin = entries.back().hashes_begin;
+	for (size_t i = hashes_begin; i < hashes.size(); i++)
+		Decrement(hashes[i]);
+
+	hashes.resize(hashes_begin);
+	entries.pop_back();
+}
+
+void AncestorFilter::PushAncestorChain(const Element* element)
+{
+	if (!element)
+		return;
+	PushAncestorChain(element->GetParentNode());
+	Push(element);
+}
+
+bool AncestorFilter::IsValidFor(const Element* element) const
+{
+	return !entries.empty() && entries.back().element == element->GetParentNode();
+}
+
+bool AncestorFilter::MayContainAll(const AncestorHashList& required_hashes) const
+{
+	for (uint32_t hash : required_hashes)
+	{
+		if (counters[hash & counter_mask] == 0 || counters[(hash >> num_counter_bits) & counter_mask] == 0)
+			return false;
+	}
+	return true;
+}
+
+void AncestorFilter::AddHashes(AncestorHashList& out_hashes, Atom tag, Atom id, const AtomList& class_names)
+{
+	if (tag != Atom::Invalid)
+		out_hashes.push_back(HashName(tag, AncestorNameType::Tag));
+	if (id != Atom::Invalid)
+		out_hashes.push_back(HashName(id, AncestorNameType::Id));
+	for (Atom name : class_names)
+		out_hashes.push_back(HashName(name, AncestorNameType::Class));
+}
+
+void AncestorFilter::Increment(uint32_t hash)
+{
+	// Saturated counters are never decremented, in which case the filter will err on the side of false positives.
+	for (uint32_t index : {hash & counter_mask, (hash >> num_counter_bits) & counter_mask})
+	{
+		if (counters[index] != 0xff)
+			counters[index] += 1;
+	}
+}
+
+void AncestorFilter::Decrement(uint32_t hash)
+{
+	for (uint32_t index : {hash & counter_mask, (hash >> num_counter_bits) & counter_mask})
+	{
+		RMLUI_ASSERT(counters[index] != 0);
+		if (counters[index] != 0xff)
+			counters[index] -= 1;
+	}
+}
+
+void AncestorFilter::ResetStatistics()
+{
+	num_rejected_nodes = 0;
+	num_traversed_nodes = 0;
+}
+
+int AncestorFilter::GetNumRejectedNodes()
+{
+	return num_rejected_nodes;
+}
+
+int AncestorFilter::GetNumTraversedNodes()
+{
+	return num_traversed_nodes;
+}
+
+void AncestorFilter::CountRejectedNode()
+{
+	num_rejected_nodes.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AncestorFilter::CountTraversedNode()
+{
+	num_traversed_nodes.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace Rml
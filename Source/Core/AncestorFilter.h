@@ -0,0 +1,97 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
+
+namespace Rml {
+
+class Element;
+using AncestorHashList = Vector<uint32_t>;
+
+/**
+	A counting bloom filter of the tag, id, and class names of the current element's ancestors.
+
+	The filter is maintained for each thread during the element update traversal, so that style sheet nodes requiring names in the element's
+	ancestors can be rejected without walking up the element hierarchy. The filter may produce false positives, but never false negatives.
+ */
+class AncestorFilter {
+public:
+	/// Returns the ancestor filter of the calling thread.
+	static AncestorFilter& Get();
+
+	/// Adds the names of an element to the filter, as the next ancestor during a downward traversal.
+	void Push(const Element* element);
+	/// Removes the most recently pushed element from the filter.
+	void Pop(const Element* element);
+
+	/// Pushes the whole chain of ancestors from the root element down to and including the given element.
+	void PushAncestorChain(const Element* element);
+
+	/// Returns true if the filter currently represents all the ancestors of the given element.
+	bool IsValidFor(const Element* element) const;
+
+	/// Returns false if any of the given hashes is definitely not present among the ancestors, otherwise true.
+	bool MayContainAll(const AncestorHashList& hashes) const;
+
+	/// Adds the filter hashes of the given names to a list.
+	static void AddHashes(AncestorHashList& hashes, Atom tag, Atom id, const AtomList& class_names);
+
+	/// Resets the selector matching statistics.
+	static void ResetStatistics();
+	/// Returns the number of style sheet nodes rejected by the filter since the last reset.
+	static int GetNumRejectedNodes();
+	/// Returns the number of style sheet nodes which required walking the element hierarchy since the last reset.
+	static int GetNumTraversedNodes();
+
+	/// Records the result of a selector match for statistics.
+	static void CountRejectedNode();
+	static void CountTraversedNode();
+
+private:
+	static constexpr uint32_t num_counter_bits = 12;
+	static constexpr uint32_t counter_mask = (1u << num_counter_bits) - 1;
+
+	void Increment(uint32_t hash);
+	void Decrement(uint32_t hash);
+
+	struct Entry {
+		const Element* element;
+		size_t hashes_begin;
+	};
+
+	Vector<Entry> entries;
+	AncestorHashList hashes;
+	uint8_t counters[1u << num_counter_bits] = {};
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,127 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Atom.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+namespace Rml {
+
+// The table may be accessed from worker threads during parallel selector matching and data view evaluation, thus all access is
+// guarded by a mutex. Names are stored in a deque so that references to them stay valid as the table grows.
+struct AtomTable {
+	AtomTable() { names.emplace_back(); }
+
+	std::mutex mutex;
+	UnorderedMap<String, Atom> atoms;
+	std::deque<String> names;
+};
+
+static AtomTable& GetAtomTable()
+{
+	static AtomTable table;
+	return table;
+}
+
+Atom MakeAtom(const String& name)
+{
+	if (name.empty())
+		return Atom::Invalid;
+
+	AtomTable& table = GetAtomTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	auto it = table.atoms.find(name);
+	if (it != table.atoms.end())
+		return it->second;
+
+	const Atom atom = Atom(table.names.size());
+	table.names.push_back(name);
+	table.atoms.emplace(name, atom);
+	return atom;
+}
+
+Atom FindAtom(const String& name)
+{
+	if (name.empty())
+		return Atom::Invalid;
+
+	AtomTable& table = GetAtomTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	auto it = table.atoms.find(name);
+	if (it != table.atoms.end())
+		return it->second;
+
+	return Atom::Invalid;
+}
+
+const String& GetAtomName(Atom atom)
+{
+	AtomTable& table = GetAtomTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	RMLUI_ASSERT(size_t(atom) < table.names.size());
+	return table.names[size_t(atom)];
+}
+
+size_t GetNumAtoms()
+{
+	AtomTable& table = GetAtomTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	return table.names.size() - 1;
+}
+
+bool InsertAtom(AtomList& list, Atom atom)
+{
+	auto it = std::lower_bound(list.begin(), list.end(), atom);
+	if (it != list.end() && *it == atom)
+		return false;
+
+	list.insert(it, atom);
+	return true;
+}
+
+bool EraseAtom(AtomList& list, Atom atom)
+{
+	auto it = std::lower_bound(list.begin(), list.end(), atom);
+	if (it == list.end() || *it != atom)
+		return false;
+
+	list.erase(it);
+	return true;
+}
+
+bool ContainsAtom(const AtomList& list, Atom atom)
+{
+	return std::binary_search(list.begin(), list.end(), atom);
+}
+
+} // namespace Rml
@@ -0,0 +1,76 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOM_H
+#define RMLUI_CORE_ATOM_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Atoms are interned names, such as tags, ids, classes and pseudo-classes. Each unique name is assigned a fixed integer identifier which is
+	valid for the lifetime of the application, so that names can be compared and hashed as plain integers during selector matching.
+
+	The atom table is thread-safe. Atoms are never released, so the table grows with every unique name seen during the lifetime of the
+	application. Generating an unbounded number of unique class names at runtime, such as names containing counters, will therefore
+	grow the table without bound; prefer attributes or data bindings for such state.
+ */
+enum class Atom : uint32_t { Invalid = 0 };
+
+// A list of atoms sorted by their identifiers.
+using AtomList = Vector<Atom>;
+
+/// Returns the atom for the given name, creating a new one if the name has not been seen before.
+/// @note Empty names always map to the invalid atom.
+Atom MakeAtom(const String& name);
+
+/// Returns the atom for the given name, or the invalid atom if the name has not been seen before.
+/// @note Use this function for queries, as it never grows the atom table.
+Atom FindAtom(const String& name);
+
+/// Returns the name of the given atom.
+/// @note The returned reference stays valid for the lifetime of the application.
+const String& GetAtomName(Atom atom);
+
+/// Returns the number of atoms that have been created.
+size_t GetNumAtoms();
+
+/// Inserts an atom into a sorted atom list, if it does not already exist.
+/// @return True if the atom was inserted.
+bool InsertAtom(AtomList& list, Atom atom);
+
+/// Removes an atom from a sorted atom list, if it exists.
+/// @return True if the atom was removed.
+bool EraseAtom(AtomList& list, Atom atom);
+
+/// Returns true if the sorted atom list contains the given atom.
+bool ContainsAtom(const AtomList& list, Atom atom);
+
+} // namespace Rml
+#endif
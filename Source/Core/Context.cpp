@@ -39,11 +39,16 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "AncestorFilter.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "LayoutEngine.h"
 #include "PluginRegistry.h"
+#include "HitTestGrid.h"
+#include "RenderCommandList.h"
 #include "StreamFile.h"
+#include "TextureResource.h"
 #include <algorithm>
 #include <iterator>
 
@@ -152,6 +157,8 @@ void Context::SetDimensions(const Vector2i _dimensions)
 	if (dimensions != _dimensions)
 	{
 		dimensions = _dimensions;
+		render_dirty = true;
+		++geometry_generation;
 		root->SetBox(Box(Vector2f(dimensions)));
 		root->DirtyLayout();
 
@@ -183,6 +190,8 @@ void Context::SetDensityIndependentPixelRatio(float _density_independent_pixel_r
 	if (density_independent_pixel_ratio != _density_independent_pixel_ratio)
 	{
 		density_independent_pixel_ratio = _density_independent_pixel_ratio;
+		render_dirty = true;
+		++geometry_generation;
 
 		for (int i = 0; i < root->GetNumChildren(true); ++i)
 		{
@@ -208,9 +217,15 @@ bool Context::Update()
 	if (autoscroll_target)
 		UpdateAutoscroll();
 
-	// Update the hover chain to detect any new or moved elements under the mouse.
-	if (mouse_active)
+	// Update the hover chain to detect any new or moved elements under the mouse. Without any movement or geometry changes since the last
+	// update, the hover chain stays the same. Dragging and autoscrolling change the cursor and drag events, so update it regardless.
+	if (mouse_active &&
+		(mouse_position != hover_chain_mouse_position || geometry_generation != hover_chain_generation || drag || autoscroll_target))
+	{
 		UpdateHoverChain(mouse_position);
+	}
+
+	AncestorFilter::ResetStatistics();
 
 	// Update all the data models before updating properties and layout.
 	for (auto& data_model : data_models)
@@ -222,7 +237,16 @@ bool Context::Update()
 	root->dirty_definition = false;
 	root->dirty_child_definitions = false;
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	// Any element visited by the update loop may change how it is rendered.
+	if (root->dirty_update || root->dirty_descendant_update)
+	{
+		render_dirty = true;
+		++geometry_generation;
+	}
+
+	num_updated_elements = root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+
+	LayoutEngine::ResetNumFormattedElements();
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 		if (auto doc = root->GetChild(i)->GetOwnerDocument())
@@ -231,12 +255,46 @@ bool Context::Update()
 			doc->UpdatePosition();
 		}
 
+	num_formatted_elements = LayoutEngine::GetNumFormattedElements();
+	if (num_formatted_elements > 0)
+	{
+		render_dirty = true;
+		++geometry_generation;
+	}
+	num_rejected_style_nodes = AncestorFilter::GetNumRejectedNodes();
+	num_traversed_style_nodes = AncestorFilter::GetNumTraversedNodes();
+
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
 
 	return true;
 }
 
+int Context::GetNumUpdatedElements() const
+{
+	return num_updated_elements;
+}
+
+int Context::GetNumFormattedElements() const
+{
+	return num_formatted_elements;
+}
+
+int Context::GetNumRejectedStyleNodes() const
+{
+	return num_rejected_style_nodes;
+}
+
+int Context::GetNumTraversedStyleNodes() const
+{
+	return num_traversed_style_nodes;
+}
+
+int Context::GetNumRenderBatches() const
+{
+	return num_render_batches;
+}
+
 // Renders all visible elements in the element tree.
 bool Context::Render()
 {
@@ -247,6 +305,21 @@ bool Context::Render()
 		return false;
 
 	render_interface->context = this;
+
+	if (render_commands)
+	{
+		// Replay the retained commands from the previous render when nothing has changed since then.
+		if (!IsRenderDirty())
+		{
+			render_commands->Submit(render_interface);
+			render_interface->context = nullptr;
+			return true;
+		}
+
+		render_commands->Clear();
+		active_render_commands = render_commands.get();
+	}
+
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
 	root->Render();
@@ -263,11 +336,44 @@ bool Context::Render()
 		cursor_proxy->Render();
 	}
 
+	if (active_render_commands)
+	{
+		active_render_commands = nullptr;
+		render_commands->Submit(render_interface);
+		num_render_batches = render_commands->GetNumBatches();
+	}
+
 	render_interface->context = nullptr;
 
+	// The cursor proxy follows the mouse, thus the drag clone needs to be rendered again on every frame.
+	render_dirty = (drag_clone != nullptr);
+	render_texture_change_counter = TextureResource::GetChangeCounter();
+
 	return true;
 }
 
+void Context::SetRenderBatching(bool enable)
+{
+	if (enable && !render_commands)
+		render_commands = MakeUnique<RenderCommandList>();
+	else if (!enable)
+		render_commands.reset();
+
+	num_render_batches = 0;
+	render_dirty = true;
+}
+
+bool Context::GetRenderBatching() const
+{
+	return render_commands != nullptr;
+}
+
+bool Context::IsRenderDirty() const
+{
+	// Released textures may be referenced by the previous render, such as when font textures are regenerated.
+	return render_dirty || render_texture_change_counter != TextureResource::GetChangeCounter();
+}
+
 // Creates a new, empty document and places it into this context. 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
@@ -426,6 +532,7 @@ void Context::EnableMouseCursor(bool enable)
 	// The cursor is set to an invalid name so that it is forced to update in the next update loop.
 	cursor_name = ":reset:";
 	enable_cursor = enable;
+	hover_chain_generation = 0;
 }
 
 void Context::ActivateTheme(const String& theme_name, bool activate)
@@ -632,7 +739,8 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	mouse_active = true;
 
 	// Update the current hover chain. This will send all necessary 'onmouseout', 'onmouseover', 'ondragout' and 'ondragover' messages.
-	Dictionary parameters, drag_parameters;
+	Dictionary parameters = std::move(spare_parameters);
+	Dictionary drag_parameters = std::move(spare_drag_parameters);
 	UpdateHoverChain(old_mouse_position, key_modifier_state, &parameters, &drag_parameters);
 
 	// Dispatch any 'onmousemove' events.
@@ -647,6 +755,9 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 		}
 	}
 
+	spare_parameters = std::move(parameters);
+	spare_drag_parameters = std::move(drag_parameters);
+
 	return !IsMouseInteracting();
 }
 
@@ -967,6 +1078,9 @@ bool Context::RemoveDataModel(const String& name)
 // Internal callback for when an element is removed from the hierarchy.
 void Context::OnElementDetach(Element* element)
 {
+	// The hit test grid must not refer to elements outside the context.
+	++geometry_generation;
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
@@ -1070,6 +1184,9 @@ bool Context::OnFocusChange(Element* new_focus)
 
 	focus = new_focus;
 
+	// A modal document restricts the elements that can be hovered.
+	hover_chain_generation = 0;
+
 	// Raise the element's document to the front, if desired.
 	ElementDocument* document = focus->GetOwnerDocument();
 	if (document != nullptr)
@@ -1108,9 +1225,22 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 {
 	const Vector2f position(mouse_position);
 
+	// Any changes made by the event listeners below advance the generation, thus the hover chain is updated again in the next update.
+	hover_chain_mouse_position = mouse_position;
+	hover_chain_generation = geometry_generation;
+
+	const bool use_local_parameters = (!out_parameters || !out_drag_parameters);
 	Dictionary local_parameters, local_drag_parameters;
+	if (use_local_parameters)
+	{
+		local_parameters = std::move(spare_parameters);
+		local_drag_parameters = std::move(spare_drag_parameters);
+	}
+
 	Dictionary& parameters = out_parameters ? *out_parameters : local_parameters;
 	Dictionary& drag_parameters = out_drag_parameters ? *out_drag_parameters : local_drag_parameters;
+	parameters.clear();
+	drag_parameters.clear();
 
 	// Generate the parameters for the mouse events (there could be a few!).
 	GenerateMouseEventParameters(parameters);
@@ -1165,7 +1295,8 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 	}
 
 	// Build the new hover chain.
-	ElementSet new_hover_chain;
+	ElementSet new_hover_chain = std::move(spare_hover_chain);
+	new_hover_chain.clear();
 	Element* element = hover;
 	while (element != nullptr)
 	{
@@ -1182,7 +1313,8 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 	{
 		drag_hover = GetElementAtPoint(position, drag);
 
-		ElementSet new_drag_hover_chain;
+		ElementSet new_drag_hover_chain = std::move(spare_drag_hover_chain);
+		new_drag_hover_chain.clear();
 		element = drag_hover;
 		while (element != nullptr)
 		{
@@ -1199,16 +1331,25 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 		}
 
 		drag_hover_chain.swap(new_drag_hover_chain);
+		spare_drag_hover_chain = std::move(new_drag_hover_chain);
 	}
 
 	// Swap the new chain in.
 	hover_chain.swap(new_hover_chain);
+	spare_hover_chain = std::move(new_hover_chain);
+
+	if (use_local_parameters)
+	{
+		spare_parameters = std::move(local_parameters);
+		spare_drag_parameters = std::move(local_drag_parameters);
+	}
 }
 
 // Returns the youngest descendent of the given element which is under the given point in screen coodinates.
 Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_element, Element* element) const
 {
-	if (element == nullptr)
+	const bool search_from_root = (element == nullptr);
+	if (search_from_root)
 	{
 		if (ignore_element == root.get())
 			return nullptr;
@@ -1219,14 +1360,29 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 	// Check if any documents have modal focus; if so, only check down than document.
 	if (element == root.get())
 	{
-		if (focus)
+		ElementDocument* focus_document = (focus ? focus->GetOwnerDocument() : nullptr);
+		if (focus_document != nullptr &&
+			focus_document->IsModal())
+		{
+			element = focus_document;
+		}
+		else if (search_from_root)
 		{
-			ElementDocument* focus_document = focus->GetOwnerDocument();
-			if (focus_document != nullptr &&
-				focus_document->IsModal())
+			// Use the grid once the same geometry is hit tested again, it finds the same element as the search below.
+			if (hit_test_grid_generation != geometry_generation && hit_test_search_generation == geometry_generation)
 			{
-				element = focus_document;
+				if (!hit_test_grid)
+					hit_test_grid = MakeUnique<HitTestGrid>();
+
+				const uint64_t generation = geometry_generation;
+				hit_test_grid->Build(root.get(), dimensions);
+				hit_test_grid_generation = generation;
 			}
+
+			if (hit_test_grid_generation == geometry_generation)
+				return hit_test_grid->GetElementAtPoint(point, ignore_element);
+
+			hit_test_search_generation = geometry_generation;
 		}
 	}
 
@@ -1261,28 +1417,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		}
 	}
 
-	// Ignore elements whose pointer events are disabled.
-	if (element->GetComputedValues().pointer_events() == Style::PointerEvents::None)
-		return nullptr;
-
-	// Projection may fail if we have a singular transformation matrix.
-	bool projection_result = element->Project(point);
-
-	// Check if the point is actually within this element.
-	bool within_element = (projection_result && element->IsPointWithinElement(point));
-	if (within_element)
-	{
-		Vector2i clip_origin, clip_dimensions;
-		if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, element))
-		{
-			within_element = point.x >= clip_origin.x &&
-							 point.y >= clip_origin.y &&
-							 point.x <= (clip_origin.x + clip_dimensions.x) &&
-							 point.y <= (clip_origin.y + clip_dimensions.y);
-		}
-	}
-
-	if (within_element)
+	if (HitTestGrid::IsElementHit(element, point))
 		return element;
 
 	return nullptr;
@@ -1496,14 +1631,20 @@ private:
 // Sends the specified event to all elements in new_items that don't appear in old_items.
 void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters)
 {
-	// We put our elements in observer pointers in case some of them are deleted during dispatch.
-	ElementObserverList elements;
+	// We put our elements in observer pointers in case some of them are deleted during dispatch. The storage is reused between calls,
+	// while any recursive calls from within the event listeners use their own.
+	static thread_local ElementObserverList spare_elements;
+	ElementObserverList elements = std::move(spare_elements);
+
 	std::set_difference(old_items.begin(), old_items.end(), new_items.begin(), new_items.end(), ElementObserverListBackInserter(elements));
 	for (auto& element : elements)
 	{
 		if (element)
 			element->DispatchEvent(id, parameters);
 	}
+
+	elements.clear();
+	spare_elements = std::move(elements);
 }
 
 void Context::Release()
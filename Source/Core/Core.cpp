@@ -50,6 +50,8 @@
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
 #include "FontEngineDefault/FontEngineInterfaceDefault.h"
+#include "FontEngineDefault/FontFaceHandleDefault.h"
+#include "FontEngineDefault/FontProvider.h"
 #endif
 
 #ifdef RMLUI_ENABLE_LOTTIE_PLUGIN
@@ -274,6 +276,8 @@ Context* CreateContext(const String& name, const Vector2i dimensions, RenderInte
 	else
 		new_context->render_interface = render_interface;
 
+	new_context->render_colour_multiplier = new_context->render_interface->SupportsColourMultiplier();
+
 	new_context->SetDimensions(dimensions);
 
 	Context* new_context_raw = new_context.get();
@@ -342,6 +346,50 @@ bool LoadFontFace(const byte* data, int data_size, const String& font_family, St
 	return font_interface->LoadFontFace(data, data_size, font_family, style, weight, fallback_face);
 }
 
+void SetFontDistanceFieldRendering(bool enable)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontProvider::SetDistanceFieldRendering(enable);
+#else
+	(void)enable;
+#endif
+}
+
+bool LoadFontCache(const String& file_path)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	if (initialised && font_interface == default_font_interface.get())
+		return FontProvider::LoadFontCache(file_path);
+#else
+	(void)file_path;
+#endif
+	Log::Message(Log::LT_WARNING, "Font cache is only supported by the default font engine, after initialisation.");
+	return false;
+}
+
+bool SaveFontCache(const String& file_path)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	if (initialised && font_interface == default_font_interface.get())
+		return FontProvider::SaveFontCache(file_path);
+#else
+	(void)file_path;
+#endif
+	Log::Message(Log::LT_WARNING, "Font cache is only supported by the default font engine, after initialisation.");
+	return false;
+}
+
+size_t GetFontKerningCacheMemoryUsage(FontFaceHandle handle)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	if (handle && font_interface && font_interface == default_font_interface.get())
+		return reinterpret_cast<FontFaceHandleDefault*>(handle)->GetKerningCacheMemoryUsage();
+#else
+	(void)handle;
+#endif
+	return 0;
+}
+
 // Registers a generic rmlui plugin
 void RegisterPlugin(Plugin* plugin)
 {
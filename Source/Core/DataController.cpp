@@ -69,5 +69,14 @@ void DataControllers::OnElementRemove(Element* element)
 	controllers.erase(element);
 }
 
+void DataControllers::RebaseAddresses(const DataAddressRebaseMap& rebase_map)
+{
+	for (auto& pair : controllers)
+	{
+		if (const DataAddressRebaseList* rebases = FindDataAddressRebases(rebase_map, pair.first))
+			pair.second->RebaseAddresses(*rebases);
+	}
+}
+
 
 } // namespace Rml
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
+#include "DataExpression.h"
 
 namespace Rml {
 
@@ -86,6 +87,9 @@ public:
     // @return True on success.
     virtual bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) = 0;
 
+    // Rebases the variable addresses of this controller, called when the controller is located within a moved data-for row.
+    virtual void RebaseAddresses(const DataAddressRebaseList& rebases) = 0;
+
     // Returns the attached element if it still exists.
     Element* GetElement() const;
 
@@ -109,6 +113,9 @@ public:
 
     void OnElementRemove(Element* element);
 
+    // Rebases the controllers located within the elements of the rebase map.
+    void RebaseAddresses(const DataAddressRebaseMap& rebase_map);
+
 private:
     using ElementControllersMap = UnorderedMultimap<Element*, DataControllerPtr>;
     ElementControllersMap controllers;
@@ -61,6 +61,12 @@ bool DataControllerValue::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerValue::RebaseAddresses(const DataAddressRebaseList& rebases)
+{
+	if (RebaseDataAddress(address, rebases))
+		address_cache.Clear();
+}
+
 void DataControllerValue::ProcessEvent(Event& event)
 {
 	if (const Element* element = GetElement())
@@ -81,9 +87,9 @@ void DataControllerValue::ProcessEvent(Event& event)
 		if (value_to_set.GetType() == Variant::NONE || !model)
 			return;
 
-		if (DataVariable variable = model->GetVariable(address))
+		if (DataVariable variable = model->GetVariable(address, address_cache))
 			if (variable.Set(value_to_set))
-				model->DirtyVariable(address.front().name);
+				model->DirtyAddress(address);
 	}
 }
 
@@ -127,6 +133,12 @@ bool DataControllerEvent::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerEvent::RebaseAddresses(const DataAddressRebaseList& rebases)
+{
+	if (expression)
+		expression->RebaseAddresses(rebases);
+}
+
 void DataControllerEvent::ProcessEvent(Event& event)
 {
 	if (!expression)
@@ -49,6 +49,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void RebaseAddresses(const DataAddressRebaseList& rebases) override;
+
 private:
     // Responds to 'Change' events.
     void ProcessEvent(Event& event) override;
@@ -57,6 +59,7 @@ private:
     void Release() override;
 
     DataAddress address;
+    DataAddressCache address_cache;
 };
 
 
@@ -67,6 +70,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void RebaseAddresses(const DataAddressRebaseList& rebases) override;
+
 protected:
     // Responds to the event type specified in the attribute modifier.
     void ProcessEvent(Event& event) override;
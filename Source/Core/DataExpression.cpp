@@ -28,6 +28,7 @@
 
 #include "DataExpression.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
+#include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
@@ -68,6 +69,7 @@ enum class Instruction {
 	Pop          = 'o',     // <R/L/C> = S-  (D determines R/L/C)
 	Literal      = 'D',     //       R = D
 	Variable     = 'V',     //       R = DataModel.GetVariable(D)  (D is an index into the variable address list)
+	ModelVariable = 'M',    //       R = DataModel.GetVariable(D)  (as above, but through the cached root variable of the address, only in compiled programs)
 	Add          = '+',     //       R = L + R
 	Subtract     = '-',     //       R = L - R
 	Multiply     = '*',     //       R = L * R
@@ -94,9 +96,24 @@ enum class Register {
 	C
 };
 
+/*
+	The statically known type of the operands of an instruction, set when compiling the program. Enables the interpreter to
+	skip type checks and conversions, and read the operands by reference.
+		Numbers   Both operands are stored as doubles.
+		Strings   Both operands are stored as strings.
+		Booleans  All operands are stored as booleans.
+*/
+enum class Operands {
+	Any,
+	Numbers,
+	Strings,
+	Booleans
+};
+
 struct InstructionData {
 	Instruction instruction;
 	Variant data;
+	Operands operands = Operands::Any;
 };
 
 namespace Parse {
@@ -764,21 +781,320 @@ namespace Parse {
 
 } // </namespace Parse>
 
+static const char* OperandsToString(Operands operands)
+{
+	switch (operands)
+	{
+	case Operands::Any: return "";
+	case Operands::Numbers: return "num";
+	case Operands::Strings: return "str";
+	case Operands::Booleans: return "bool";
+	}
+	return "";
+}
+
 static String DumpProgram(const Program& program)
 {
 	String str;
 	for (size_t i = 0; i < program.size(); i++)
 	{
 		String instruction_str = program[i].data.Get<String>();
-		str += CreateString(50 + instruction_str.size(), "  %4zu  '%c'  %s\n", i, char(program[i].instruction), instruction_str.c_str());
+		str += CreateString(60 + instruction_str.size(), "  %4zu  '%c'  %-4s  %s\n", i, char(program[i].instruction),
+			OperandsToString(program[i].operands), instruction_str.c_str());
 	}
 	return str;
 }
 
+// Executes the operator instruction on the registers, as in R = L <op> R. Returns false if the instruction is not an operator.
+static bool ExecuteOperator(const Instruction instruction, const Operands operands, const Variant& L, Variant& R)
+{
+	auto AnyString = [](const Variant& v1, const Variant& v2) {
+		return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING;
+	};
+	auto Number = [operands](const Variant& v) {
+		return operands == Operands::Numbers ? v.GetReference<double>() : v.Get<double>();
+	};
+	auto Boolean = [operands](const Variant& v) {
+		return operands == Operands::Booleans ? v.GetReference<bool>() : v.Get<bool>();
+	};
+
+	switch (instruction)
+	{
+	case Instruction::Add:
+	{
+		if (operands == Operands::Strings)
+			R = Variant(L.GetReference<String>() + R.GetReference<String>());
+		else if (operands != Operands::Numbers && AnyString(L, R))
+			R = Variant(L.Get<String>() + R.Get<String>());
+		else
+			R = Variant(Number(L) + Number(R));
+	}
+	break;
+	case Instruction::Subtract:  R = Variant(Number(L) - Number(R));    break;
+	case Instruction::Multiply:  R = Variant(Number(L) * Number(R));    break;
+	case Instruction::Divide:    R = Variant(Number(L) / Number(R));    break;
+	case Instruction::Not:       R = Variant(!Boolean(R));              break;
+	case Instruction::And:       R = Variant(Boolean(L) && Boolean(R)); break;
+	case Instruction::Or:        R = Variant(Boolean(L) || Boolean(R)); break;
+	case Instruction::Less:      R = Variant(Number(L) < Number(R));    break;
+	case Instruction::LessEq:    R = Variant(Number(L) <= Number(R));   break;
+	case Instruction::Greater:   R = Variant(Number(L) > Number(R));    break;
+	case Instruction::GreaterEq: R = Variant(Number(L) >= Number(R));   break;
+	case Instruction::Equal:
+	case Instruction::NotEqual:
+	{
+		bool equal = false;
+		if (operands == Operands::Strings)
+			equal = (L.GetReference<String>() == R.GetReference<String>());
+		else if (operands != Operands::Numbers && AnyString(L, R))
+			equal = (L.Get<String>() == R.Get<String>());
+		else
+			equal = (Number(L) == Number(R));
+
+		R = Variant(instruction == Instruction::Equal ? equal : !equal);
+	}
+	break;
+	case Instruction::Push:
+	case Instruction::Pop:
+	case Instruction::Literal:
+	case Instruction::Variable:
+	case Instruction::ModelVariable:
+	case Instruction::Ternary:
+	case Instruction::NumArguments:
+	case Instruction::TransformFnc:
+	case Instruction::EventFnc:
+	case Instruction::Assign:
+		return false;
+	}
+
+	return true;
+}
+
+namespace Compile {
+
+	static bool IsBinaryOperator(Instruction instruction)
+	{
+		switch (instruction)
+		{
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
+		case Instruction::Equal:
+		case Instruction::NotEqual:
+			return true;
+		case Instruction::Push:
+		case Instruction::Pop:
+		case Instruction::Literal:
+		case Instruction::Variable:
+		case Instruction::ModelVariable:
+		case Instruction::Not:
+		case Instruction::Ternary:
+		case Instruction::NumArguments:
+		case Instruction::TransformFnc:
+		case Instruction::EventFnc:
+		case Instruction::Assign:
+			break;
+		}
+		return false;
+	}
+
+	static bool IsPop(const InstructionData& data, Register reg)
+	{
+		return data.instruction == Instruction::Pop && data.data.Get<int>(-1) == int(reg);
+	}
+
+	// Replaces variables by their cached lookup, or by their value for literal addresses.
+	static void ResolveVariables(Program& program, const AddressList& addresses)
+	{
+		for (InstructionData& data : program)
+		{
+			if (data.instruction != Instruction::Variable)
+				continue;
+
+			const size_t variable_index = size_t(data.data.Get<int>(-1));
+			if (variable_index >= addresses.size() || addresses[variable_index].empty())
+				continue;
+
+			const DataAddress& address = addresses[variable_index];
+			const String& name = address.front().name;
+			if (name == "literal")
+			{
+				if (address.size() > 2 && address[1].name == "int")
+					data = InstructionData{Instruction::Literal, Variant(address[2].index)};
+			}
+			else if (name != "ev")
+			{
+				data.instruction = Instruction::ModelVariable;
+			}
+		}
+	}
+
+	// Evaluates any operators whose operands are all literals, until no more operators can be folded.
+	static void FoldConstants(Program& program)
+	{
+		bool folded = true;
+		while (folded)
+		{
+			folded = false;
+			for (size_t i = 0; i < program.size(); i++)
+			{
+				// [Literal] [Not]
+				if (i + 1 < program.size() && program[i].instruction == Instruction::Literal && program[i + 1].instruction == Instruction::Not)
+				{
+					Variant R = std::move(program[i].data);
+					ExecuteOperator(Instruction::Not, Operands::Any, Variant(), R);
+					program[i].data = std::move(R);
+					program.erase(program.begin() + i + 1);
+					folded = true;
+				}
+				// [Literal] [Push] [Literal] [Pop L] [Binary operator]
+				else if (i + 4 < program.size() && program[i].instruction == Instruction::Literal && program[i + 1].instruction == Instruction::Push &&
+					program[i + 2].instruction == Instruction::Literal && IsPop(program[i + 3], Register::L) && IsBinaryOperator(program[i + 4].instruction))
+				{
+					Variant R = std::move(program[i + 2].data);
+					ExecuteOperator(program[i + 4].instruction, Operands::Any, program[i].data, R);
+					program[i].data = std::move(R);
+					program.erase(program.begin() + i + 1, program.begin() + i + 5);
+					folded = true;
+				}
+				// [Literal] [Push] [Literal] [Push] [Literal] [Pop C] [Pop L] [Ternary]
+				else if (i + 7 < program.size() && program[i].instruction == Instruction::Literal && program[i + 1].instruction == Instruction::Push &&
+					program[i + 2].instruction == Instruction::Literal && program[i + 3].instruction == Instruction::Push &&
+					program[i + 4].instruction == Instruction::Literal && IsPop(program[i + 5], Register::C) && IsPop(program[i + 6], Register::L) &&
+					program[i + 7].instruction == Instruction::Ternary)
+				{
+					Variant R = (program[i].data.Get<bool>() ? std::move(program[i + 2].data) : std::move(program[i + 4].data));
+					program[i].data = std::move(R);
+					program.erase(program.begin() + i + 1, program.begin() + i + 8);
+					folded = true;
+				}
+			}
+		}
+	}
+
+	// Tracks the types stored in the registers and on the stack, and specializes the operators whose operand types are known.
+	static void SpecializeOperators(Program& program)
+	{
+		// Unknown types are denoted by 'NONE'.
+		Variant::Type R = Variant::NONE, L = Variant::NONE, C = Variant::NONE;
+		Vector<Variant::Type> stack;
+
+		for (InstructionData& data : program)
+		{
+			const Instruction instruction = data.instruction;
+			switch (instruction)
+			{
+			case Instruction::Push:
+				stack.push_back(R);
+				R = Variant::NONE;
+				break;
+			case Instruction::Pop:
+			{
+				const Variant::Type type = (stack.empty() ? Variant::NONE : stack.back());
+				if (!stack.empty())
+					stack.pop_back();
+
+				switch (Register(data.data.Get<int>(-1)))
+				{
+				case Register::R: R = type; break;
+				case Register::L: L = type; break;
+				case Register::C: C = type; break;
+				}
+			}
+			break;
+			case Instruction::Literal:
+				R = data.data.GetType();
+				break;
+			case Instruction::Ternary:
+				R = (R == C ? R : Variant::NONE);
+				break;
+			case Instruction::Not:
+				if (R == Variant::BOOL)
+					data.operands = Operands::Booleans;
+				R = Variant::BOOL;
+				break;
+			case Instruction::Assign:
+				break;
+			case Instruction::NumArguments:
+			{
+				// The function arguments are consumed from the stack by the following function instruction.
+				const size_t num_arguments = size_t(Math::Max(data.data.Get<int>(0), 0));
+				stack.resize(stack.size() - Math::Min(num_arguments, stack.size()));
+				R = Variant::NONE;
+			}
+			break;
+			case Instruction::Variable:
+			case Instruction::ModelVariable:
+			case Instruction::TransformFnc:
+			case Instruction::EventFnc:
+				R = Variant::NONE;
+				break;
+			case Instruction::Add:
+			case Instruction::Subtract:
+			case Instruction::Multiply:
+			case Instruction::Divide:
+			case Instruction::And:
+			case Instruction::Or:
+			case Instruction::Less:
+			case Instruction::LessEq:
+			case Instruction::Greater:
+			case Instruction::GreaterEq:
+			case Instruction::Equal:
+			case Instruction::NotEqual:
+			{
+
+				const bool string_operator = (instruction == Instruction::Add || instruction == Instruction::Equal || instruction == Instruction::NotEqual);
+				const bool boolean_operator = (instruction == Instruction::And || instruction == Instruction::Or);
+
+				if (boolean_operator)
+					data.operands = (L == Variant::BOOL && R == Variant::BOOL ? Operands::Booleans : Operands::Any);
+				else if (L == Variant::DOUBLE && R == Variant::DOUBLE)
+					data.operands = Operands::Numbers;
+				else if (string_operator && L == Variant::STRING && R == Variant::STRING)
+					data.operands = Operands::Strings;
+
+				if (instruction == Instruction::Add)
+				{
+					if (L == Variant::STRING || R == Variant::STRING)
+						R = Variant::STRING;
+					else if (L == Variant::NONE || R == Variant::NONE)
+						R = Variant::NONE;
+					else
+						R = Variant::DOUBLE;
+				}
+				else if (instruction == Instruction::Subtract || instruction == Instruction::Multiply || instruction == Instruction::Divide)
+					R = Variant::DOUBLE;
+				else
+					R = Variant::BOOL;
+			}
+			break;
+			}
+		}
+	}
+
+} // </namespace Compile>
+
+// Compiles the parsed program for faster execution.
+static Program CompileProgram(const Program& parsed_program, const AddressList& addresses)
+{
+	Program program = parsed_program;
+	Compile::ResolveVariables(program, addresses);
+	Compile::FoldConstants(program);
+	Compile::SpecializeOperators(program);
+	return program;
+}
+
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	DataInterpreter(const Program& program, const AddressList& addresses, Vector<DataAddressCache>& address_cache, DataExpressionInterface expression_interface)
+		: program(program), addresses(addresses), address_cache(address_cache), expression_interface(expression_interface) {}
 
 	bool Error(const String& message) const
 	{
@@ -792,7 +1108,7 @@ public:
 		bool success = true;
 		for (size_t i = 0; i < program.size(); i++)
 		{
-			if (!Execute(program[i].instruction, program[i].data))
+			if (!Execute(program[i].instruction, program[i].data, program[i].operands))
 			{
 				success = false;
 				break;
@@ -823,14 +1139,11 @@ private:
 
 	const Program& program;
 	const AddressList& addresses;
+	Vector<DataAddressCache>& address_cache;
 	DataExpressionInterface expression_interface;
 
-	bool Execute(const Instruction instruction, const Variant& data)
+	bool Execute(const Instruction instruction, const Variant& data, const Operands operands)
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) {
-			return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING;
-		};
-
 		switch (instruction)
 		{
 		case Instruction::Push:
@@ -868,38 +1181,30 @@ private:
 				return Error("Variable address not found.");
 		}
 		break;
-		case Instruction::Add:
+		case Instruction::ModelVariable:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
+			size_t variable_index = size_t(data.Get<int>(-1));
+			if (variable_index < addresses.size())
+				GetModelVariable(variable_index);
 			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+				return Error("Variable address not found.");
 		}
 		break;
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::Not:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
 		case Instruction::Equal:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
-		}
-		break;
 		case Instruction::NotEqual:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+			ExecuteOperator(instruction, operands, L, R);
 		}
 		break;
 		case Instruction::Ternary:
@@ -957,6 +1262,20 @@ private:
 		return true;
 	}
 
+	// Reads the variable through its cached address resolution, falls back to looking up the full address on failure.
+	void GetModelVariable(size_t variable_index)
+	{
+		const DataAddress& address = addresses[variable_index];
+		RMLUI_ASSERT(!address.empty());
+
+		if (address_cache.size() < addresses.size())
+			address_cache.resize(addresses.size());
+
+		DataVariable variable = expression_interface.GetVariable(address, address_cache[variable_index]);
+		if (!variable || !variable.Get(R))
+			R = expression_interface.GetValue(address);
+	}
+
 	bool ExtractArgumentsFromStack(Vector<Variant>& out_arguments)
 	{
 		int num_arguments = R.Get<int>(-1);
@@ -989,12 +1308,15 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
 
+	compiled_program = CompileProgram(program, addresses);
+	address_cache.clear();
+
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	DataInterpreter interpreter(compiled_program, addresses, address_cache, expression_interface);
 	
 	if (!interpreter.Run())
 		return false;
@@ -1003,18 +1325,71 @@ bool DataExpression::Run(const DataExpressionInterface& expression_interface, Va
 	return true;
 }
 
-StringList DataExpression::GetVariableNameList() const
+AddressList DataExpression::GetVariableAddressList() const
 {
-	StringList list;
+	AddressList list;
 	list.reserve(addresses.size());
 	for (const DataAddress& address : addresses)
 	{
 		if (!address.empty())
-			list.push_back(address[0].name);
+			list.push_back(address);
 	}
 	return list;
 }
 
+void DataExpression::RebaseAddresses(const DataAddressRebaseList& rebases)
+{
+	bool rebased = false;
+	for (DataAddress& address : addresses)
+		rebased |= RebaseDataAddress(address, rebases);
+
+	// Literal addresses are folded into the compiled program, and the cached variables may no longer apply.
+	if (rebased)
+	{
+		compiled_program = CompileProgram(program, addresses);
+		address_cache.clear();
+	}
+}
+
+bool RebaseDataAddress(DataAddress& address, const DataAddressRebaseList& rebases)
+{
+	for (const DataAddressRebase& rebase : rebases)
+	{
+		const size_t num_entries = rebase.from.size();
+		RMLUI_ASSERT(num_entries == rebase.to.size());
+		if (address.size() < num_entries)
+			continue;
+
+		bool match = true;
+		for (size_t i = 0; i < num_entries && match; i++)
+		{
+			const DataAddressEntry& entry = address[i];
+			const DataAddressEntry& from_entry = rebase.from[i];
+			match = (entry.index == from_entry.index && entry.name == from_entry.name);
+		}
+
+		if (match)
+		{
+			for (size_t i = 0; i < num_entries; i++)
+				address[i] = rebase.to[i];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const DataAddressRebaseList* FindDataAddressRebases(const DataAddressRebaseMap& rebase_map, Element* element)
+{
+	for (Element* ancestor = element; ancestor; ancestor = ancestor->GetParentNode())
+	{
+		auto it = rebase_map.find(ancestor);
+		if (it != rebase_map.end())
+			return &it->second;
+	}
+	return nullptr;
+}
+
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) : data_model(data_model), element(element), event(event)
 {}
 
@@ -1025,6 +1400,11 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 
 	return data_model ? data_model->ResolveAddress(address_str, element) : DataAddress();
 }
+DataVariable DataExpressionInterface::GetVariable(const DataAddress& address, DataAddressCache& cache) const
+{
+	return data_model ? data_model->GetVariable(address, cache) : DataVariable();
+}
+
 Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 {
 	Variant result;
@@ -1051,7 +1431,7 @@ bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant
 			result = variable.Set(value);
 
 		if (result)
-			data_model->DirtyVariable(address.front().name);
+			data_model->DirtyAddress(address);
 	}
 	return result;
 }
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 
 namespace Rml {
 
@@ -41,12 +42,47 @@ struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
 
+// Moves variable addresses starting with the entries 'from' to instead start with the entries 'to', such as when a data-for row changes its index.
+struct DataAddressRebase {
+    DataAddress from;
+    DataAddress to;
+};
+using DataAddressRebaseList = Vector<DataAddressRebase>;
+using DataAddressRebaseMap = UnorderedMap<Element*, DataAddressRebaseList>;
+
+// Applies the first matching rebase to the address, returns true if the address was changed.
+bool RebaseDataAddress(DataAddress& address, const DataAddressRebaseList& rebases);
+
+// Returns the rebases of the element or its closest ancestor found in the map, or nullptr if there are none.
+const DataAddressRebaseList* FindDataAddressRebases(const DataAddressRebaseMap& rebase_map, Element* element);
+
+/*
+    Caches the resolution of an address to its data variable, see DataModel::GetVariable(). The root variable is looked up once,
+    and struct members are stored as their member definitions, thus no names are looked up when retrieving the variable. Array
+    entries and pointers are still followed on every retrieval, so the cache stays valid when arrays are resized or pointers
+    change, and it can be used for any addresses differing only by their array indices. Must be cleared when the address changes.
+*/
+class DataAddressCache {
+public:
+    void Clear() {
+        root = DataVariable();
+        member_definitions.clear();
+    }
+
+private:
+    DataVariable root;
+    Vector<VariableDefinition*> member_definitions;
+
+    friend class DataModel;
+};
+
 class DataExpressionInterface {
 public:
     DataExpressionInterface() = default;
     DataExpressionInterface(DataModel* data_model, Element* element, Event* event = nullptr);
 
     DataAddress ParseAddress(const String& address_str) const;
+    DataVariable GetVariable(const DataAddress& address, DataAddressCache& cache) const;
     Variant GetValue(const DataAddress& address) const;
     bool SetValue(const DataAddress& address, const Variant& value) const;
     bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
@@ -69,13 +105,20 @@ public:
     bool Run(const DataExpressionInterface& expression_interface, Variant& out_value);
 
     // Available after Parse()
-    StringList GetVariableNameList() const;
+    AddressList GetVariableAddressList() const;
+
+    // Rebases the variable addresses of the expression, available after Parse().
+    void RebaseAddresses(const DataAddressRebaseList& rebases);
 
 private:
     String expression;
     
     Program program;
     AddressList addresses;
+
+    // The program compiled from the parsed program, and the resolution of its addresses cached on first use.
+    Program compiled_program;
+    Vector<DataAddressCache> address_cache;
 };
 
 } // namespace Rml
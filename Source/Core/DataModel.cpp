@@ -232,6 +232,24 @@ bool DataModel::EraseAliases(Element* element)
 	return aliases.erase(element) == 1;
 }
 
+void DataModel::RebaseAddresses(const DataAddressRebaseMap& rebase_map)
+{
+	if (rebase_map.empty())
+		return;
+
+	for (auto& element_aliases : aliases)
+	{
+		if (const DataAddressRebaseList* rebases = FindDataAddressRebases(rebase_map, element_aliases.first))
+		{
+			for (auto& alias : element_aliases.second)
+				RebaseDataAddress(alias.second, *rebases);
+		}
+	}
+
+	views->RebaseAddresses(rebase_map);
+	controllers->RebaseAddresses(rebase_map);
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -308,6 +326,39 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetVariable(const DataAddress& address, DataAddressCache& cache) const
+{
+	if (!cache.root || cache.member_definitions.size() != address.size())
+	{
+		if (address.empty())
+			return DataVariable();
+
+		auto it = variables.find(address.front().name);
+		if (it == variables.end())
+			return GetVariable(address);
+
+		cache.root = it->second;
+		cache.member_definitions.assign(address.size(), nullptr);
+	}
+
+	DataVariable variable = cache.root;
+
+	for (size_t i = 1; i < address.size(); i++)
+	{
+		const DataAddressEntry& entry = address[i];
+		VariableDefinition*& member_definition = cache.member_definitions[i];
+
+		if (!member_definition && entry.index < 0)
+			member_definition = variable.MemberDefinition(entry.name);
+
+		variable = (member_definition ? variable.Member(member_definition) : variable.Child(entry));
+		if (!variable)
+			return DataVariable();
+	}
+
+	return variable;
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -328,17 +379,89 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
-void DataModel::DirtyVariable(const String& variable_name)
+void DataModel::DirtyVariable(const String& variable_name_or_address)
 {
-	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
-	dirty_variables.emplace(variable_name);
+	if (variable_name_or_address.find_first_of(".[") == String::npos)
+	{
+		const String& variable_name = variable_name_or_address;
+		RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided.");
+		RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
+		dirty_variables.emplace(variable_name);
+		return;
+	}
+
+	DataAddress address = ParseAddress(variable_name_or_address);
+	if (address.empty() || variables.count(address.front().name) == 0)
+	{
+		Log::Message(Log::LT_WARNING, "Could not dirty data variable address '%s', invalid address or variable not found.",
+			variable_name_or_address.c_str());
+		return;
+	}
+
+	DirtyAddress(address);
+}
+
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	const String& variable_name = address.front().name;
+	if (address.size() == 1)
+		dirty_variables.emplace(variable_name);
+	else if (dirty_variables.count(variable_name) == 0)
+		dirty_addresses.push_back(address);
+}
+
+void DataModel::DirtyVariableStructure(const String& variable_name_or_address)
+{
+	DataAddress address = ParseAddress(variable_name_or_address);
+	if (address.empty() || variables.count(address.front().name) == 0)
+	{
+		Log::Message(Log::LT_WARNING, "Could not dirty the structure of data variable address '%s', invalid address or variable not found.",
+			variable_name_or_address.c_str());
+		return;
+	}
+
+	if (!IsAddressDirty(address))
+		dirty_structure_addresses.push_back(std::move(address));
 }
 
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	if (dirty_variables.count(variable_name) == 1)
+		return true;
+
+	auto has_variable_name = [&variable_name](const DataAddress& address) { return address.front().name == variable_name; };
+	return std::any_of(dirty_addresses.begin(), dirty_addresses.end(), has_variable_name) ||
+		std::any_of(dirty_structure_addresses.begin(), dirty_structure_addresses.end(), has_variable_name);
+}
+
+// Returns true if any of the addresses equals or is a parent of the given address.
+static bool ContainsParentAddress(const Vector<DataAddress>& addresses, const DataAddress& address)
+{
+	return std::any_of(addresses.begin(), addresses.end(), [&address](const DataAddress& parent_address) {
+		return parent_address.size() <= address.size() &&
+			std::equal(parent_address.begin(), parent_address.end(), address.begin(),
+				[](const DataAddressEntry& lhs, const DataAddressEntry& rhs) { return lhs.index == rhs.index && lhs.name == rhs.name; });
+	});
+}
+
+bool DataModel::IsAddressDirty(const DataAddress& address) const
+{
+	if (address.empty())
+		return false;
+
+	if (dirty_variables.count(address.front().name) == 1)
+		return true;
+
+	return ContainsParentAddress(dirty_addresses, address);
+}
+
+bool DataModel::IsStructureDirty(const DataAddress& address) const
+{
+	return !address.empty() && ContainsParentAddress(dirty_structure_addresses, address) && !IsAddressDirty(address);
 }
 
 void DataModel::DirtyAllVariables() {
@@ -346,6 +469,8 @@ void DataModel::DirtyAllVariables() {
 	for (const auto& variable : variables) {
 		dirty_variables.emplace(variable.first);
 	}
+	dirty_addresses.clear();
+	dirty_structure_addresses.clear();
 }
 
 bool DataModel::CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const
@@ -375,10 +500,14 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses, dirty_structure_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+		dirty_structure_addresses.clear();
+	}
 	
 	return result;
 }
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "DataExpression.h"
 
 namespace Rml {
 
@@ -60,14 +61,28 @@ public:
 	bool InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
 	bool EraseAliases(Element* element);
 
+	// Rebases the addresses of all aliases, views, and controllers located within the elements of the rebase map, including their descendants.
+	void RebaseAddresses(const DataAddressRebaseMap& rebase_map);
+
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
+	// Retrieves the variable through the given cache, which is filled on first use. Prefer this for repeated retrievals of the same address.
+	DataVariable GetVariable(const DataAddress& address, DataAddressCache& cache) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
-	void DirtyVariable(const String& variable_name);
+	// Dirty a top-level variable, or a part of it by an address string such as 'inventory[42].count'.
+	void DirtyVariable(const String& variable_name_or_address);
+	// Dirty the given resolved address, only views depending on the address or any of its parents or children are updated.
+	void DirtyAddress(const DataAddress& address);
+	// Dirty only the structure of an array by its address string, views depending on the array itself or its size are updated.
+	void DirtyVariableStructure(const String& variable_name_or_address);
 	bool IsVariableDirty(const String& variable_name) const;
+	// Returns true if the address or any of its parents has been dirtied, not counting structural changes.
+	bool IsAddressDirty(const DataAddress& address) const;
+	// Returns true if only the structure of the address or any of its parents has been dirtied.
+	bool IsStructureDirty(const DataAddress& address) const;
 	void DirtyAllVariables();
 
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const;
@@ -80,12 +95,18 @@ public:
 
 	bool Update(bool clear_dirty_variables);
 
+	// Allows the expressions of the views to be evaluated on worker threads.
+	void SetParallelEvaluation(bool enable) { parallel_evaluation = enable; }
+	bool IsParallelEvaluationEnabled() const { return parallel_evaluation; }
+
 private:
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	Vector<DataAddress> dirty_addresses;
+	Vector<DataAddress> dirty_structure_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -96,6 +117,8 @@ private:
 	const TransformFuncRegister* transform_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
+
+	bool parallel_evaluation = false;
 };
 
 
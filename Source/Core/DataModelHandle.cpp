@@ -39,8 +39,12 @@ bool DataModelHandle::IsVariableDirty(const String& variable_name) {
 	return model->IsVariableDirty(variable_name);
 }
 
-void DataModelHandle::DirtyVariable(const String& variable_name) {
-	model->DirtyVariable(variable_name);
+void DataModelHandle::DirtyVariable(const String& variable_name_or_address) {
+	model->DirtyVariable(variable_name_or_address);
+}
+
+void DataModelHandle::DirtyVariableStructure(const String& variable_name_or_address) {
+	model->DirtyVariableStructure(variable_name_or_address);
 }
 
 void DataModelHandle::DirtyAllVariables() {
@@ -66,6 +70,10 @@ bool DataModelConstructor::BindEventCallback(const String& name, DataEventFunc e
 	return model->BindEventCallback(name, std::move(event_func));
 }
 
+void DataModelConstructor::SetParallelEvaluation(bool enable) {
+	model->SetParallelEvaluation(enable);
+}
+
 bool DataModelConstructor::BindVariable(const String& name, DataVariable data_variable) {
 	return model->BindVariable(name, data_variable);
 }
@@ -50,6 +50,14 @@ DataVariableType DataVariable::Type() {
     return definition->Type();
 }
 
+VariableDefinition* DataVariable::MemberDefinition(const String& name) {
+    return definition->MemberDefinition(name);
+}
+
+DataVariable DataVariable::Member(VariableDefinition* member_definition) {
+    return definition->Member(ptr, member_definition);
+}
+
 
 bool VariableDefinition::Get(void* /*ptr*/, Variant& /*variant*/) {
     Log::Message(Log::LT_WARNING, "Values can only be retrieved from scalar data types.");
@@ -67,6 +75,13 @@ DataVariable VariableDefinition::Child(void* /*ptr*/, const DataAddressEntry& /*
     Log::Message(Log::LT_WARNING, "Tried to get the child of a scalar type.");
     return DataVariable();
 }
+VariableDefinition* VariableDefinition::MemberDefinition(const String& /*name*/) {
+    return nullptr;
+}
+DataVariable VariableDefinition::Member(void* /*ptr*/, VariableDefinition* /*member_definition*/) {
+    Log::Message(Log::LT_WARNING, "Tried to get a member of a non-struct data type.");
+    return DataVariable();
+}
 
 class LiteralIntDefinition final : public VariableDefinition {
 public:
@@ -109,6 +124,20 @@ DataVariable StructDefinition::Child(void* ptr, const DataAddressEntry& address)
     return DataVariable(next_definition, ptr);
 }
 
+VariableDefinition* StructDefinition::MemberDefinition(const String& name)
+{
+    auto it = members.find(name);
+    if (it == members.end())
+        return nullptr;
+    return it->second.get();
+}
+
+DataVariable StructDefinition::Member(void* ptr, VariableDefinition* member_definition)
+{
+    RMLUI_ASSERT(member_definition);
+    return DataVariable(member_definition, ptr);
+}
+
 void StructDefinition::AddMember(const String& name, UniquePtr<VariableDefinition> member)
 {
     RMLUI_ASSERT(member);
@@ -167,4 +196,16 @@ DataVariable BasePointerDefinition::Child(void* ptr, const DataAddressEntry& add
     return underlying_definition->Child(DereferencePointer(ptr), address);
 }
 
+VariableDefinition* BasePointerDefinition::MemberDefinition(const String& name)
+{
+    return underlying_definition->MemberDefinition(name);
+}
+
+DataVariable BasePointerDefinition::Member(void* ptr, VariableDefinition* member_definition)
+{
+    if(!ptr)
+        return DataVariable();
+    return underlying_definition->Member(DereferencePointer(ptr), member_definition);
+}
+
 } // namespace Rml
@@ -27,7 +27,11 @@
  */
 
 #include "DataView.h"
+#include "DataModel.h"
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include <algorithm>
 
 namespace Rml {
@@ -43,6 +47,14 @@ Element* DataView::GetElement() const
 	return result;
 }
 
+bool DataView::Evaluate(DataModel& /*model*/) {
+	return false;
+}
+
+bool DataView::IsStructural() const {
+	return false;
+}
+
 int DataView::GetSortOrder() const {
 	return sort_order;
 }
@@ -62,6 +74,99 @@ DataView::DataView(Element* element, int bias) : attached_element(element->GetOb
 }
 
 
+static const DataViewAddressNode* FindChildNode(const DataViewAddressNode& node, const DataAddressEntry& entry)
+{
+	if (entry.index >= 0)
+	{
+		auto it = node.index_children.find(entry.index);
+		return it == node.index_children.end() ? nullptr : it->second.get();
+	}
+
+	auto it = node.name_children.find(entry.name);
+	return it == node.name_children.end() ? nullptr : it->second.get();
+}
+
+static void CollectDescendantViews(const DataViewAddressNode& node, Vector<DataView*>& dirty_views)
+{
+	for (auto& pair : node.name_children)
+	{
+		dirty_views.insert(dirty_views.end(), pair.second->views.begin(), pair.second->views.end());
+		CollectDescendantViews(*pair.second, dirty_views);
+	}
+	for (auto& pair : node.index_children)
+	{
+		dirty_views.insert(dirty_views.end(), pair.second->views.begin(), pair.second->views.end());
+		CollectDescendantViews(*pair.second, dirty_views);
+	}
+}
+
+// Removes the view from the node at the given address, and prunes any nodes left empty. Returns true if the node itself is left empty.
+static bool RemoveViewFromNode(DataViewAddressNode& node, const DataAddress& address, size_t address_index, DataView* view)
+{
+	if (address_index == address.size())
+	{
+		auto it = std::find(node.views.begin(), node.views.end(), view);
+		if (it != node.views.end())
+			node.views.erase(it);
+	}
+	else
+	{
+		const DataAddressEntry& entry = address[address_index];
+		if (entry.index >= 0)
+		{
+			auto it = node.index_children.find(entry.index);
+			if (it != node.index_children.end() && RemoveViewFromNode(*it->second, address, address_index + 1, view))
+				node.index_children.erase(it);
+		}
+		else
+		{
+			auto it = node.name_children.find(entry.name);
+			if (it != node.name_children.end() && RemoveViewFromNode(*it->second, address, address_index + 1, view))
+				node.name_children.erase(it);
+		}
+	}
+
+	return node.views.empty() && node.name_children.empty() && node.index_children.empty();
+}
+
+// Returns true if the view should be updated. Views are removed from the data model along with their elements, however, the elements
+// of removed data-for rows may still exist to be reused for other rows.
+static bool IsViewAttached(const DataView* view, const DataModel& model)
+{
+	return view && view->IsValid() && view->GetElement()->GetDataModel() == &model;
+}
+
+// Evaluates the expressions of the views in the given range in parallel when worker threads are available, the views then apply their
+// staged results in order during the update.
+static void EvaluateViewsParallel(DataModel& model, const Vector<DataView*>& dirty_views, int begin, int end)
+{
+	// Only worth the overhead for large updates, such as when filling or scrolling long lists. Views are evaluated in batches, as each
+	// view is fairly cheap to evaluate.
+	static constexpr int min_parallel_views = 64;
+	static constexpr int views_per_task = 16;
+
+	const int num_views = end - begin;
+	if (num_views < min_parallel_views)
+		return;
+
+	SystemInterface* system_interface = ::Rml::GetSystemInterface();
+	if (!system_interface || system_interface->GetNumWorkerThreads() <= 0)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	const int num_tasks = (num_views + views_per_task - 1) / views_per_task;
+	system_interface->RunParallelTasks(num_tasks, [&model, &dirty_views, begin, end](int i) {
+		const int task_end = Math::Min(begin + (i + 1) * views_per_task, end);
+		for (int j = begin + i * views_per_task; j < task_end; j++)
+		{
+			DataView* view = dirty_views[j];
+			if (IsViewAttached(view, model))
+				view->Evaluate(model);
+		}
+	});
+}
+
 DataViews::DataViews()
 {}
 
@@ -87,17 +192,101 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+void DataViews::RebaseAddresses(const DataAddressRebaseMap& rebase_map)
+{
+	for (auto& view : views)
+	{
+		if (const DataAddressRebaseList* rebases = FindDataAddressRebases(rebase_map, view->GetElement()))
+		{
+			RemoveFromIndex(view.get());
+			view->RebaseAddresses(*rebases);
+			AddToIndex(view.get());
+		}
+	}
+
+	// Views not yet added are indexed on their next update.
+	for (auto& view : views_to_add)
+	{
+		if (const DataAddressRebaseList* rebases = FindDataAddressRebases(rebase_map, view->GetElement()))
+			view->RebaseAddresses(*rebases);
+	}
+}
+
+void DataViews::AddToIndex(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		AddressNode* node = &address_index;
+		for (const DataAddressEntry& entry : address)
+		{
+			UniquePtr<AddressNode>& child = (entry.index >= 0 ? node->index_children[entry.index] : node->name_children[entry.name]);
+			if (!child)
+				child = MakeUnique<AddressNode>();
+			node = child.get();
+		}
+		node->views.push_back(view);
+	}
+}
+
+void DataViews::RemoveFromIndex(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+		RemoveViewFromNode(address_index, address, 0, view);
+}
+
+void DataViews::CollectDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const
+{
+	// Views depending on the dirty address itself or any of its parents.
+	const AddressNode* node = &address_index;
+	for (const DataAddressEntry& entry : address)
+	{
+		node = FindChildNode(*node, entry);
+		if (!node)
+			return;
+
+		dirty_views.insert(dirty_views.end(), node->views.begin(), node->views.end());
+	}
+
+	// Views depending on any children of the dirty address.
+	CollectDescendantViews(*node, dirty_views);
+}
+
+void DataViews::CollectStructureDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const
+{
+	// Views depending on the dirty address itself or any of its parents.
+	const AddressNode* node = &address_index;
+	for (const DataAddressEntry& entry : address)
+	{
+		node = FindChildNode(*node, entry);
+		if (!node)
+			return;
+
+		dirty_views.insert(dirty_views.end(), node->views.begin(), node->views.end());
+	}
+
+	// Views depending on the size of the array, but not on any of its entries.
+	auto it = node->name_children.find("size");
+	if (it != node->name_children.end())
+		dirty_views.insert(dirty_views.end(), it->second->views.begin(), it->second->views.end());
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const DataAddressList& dirty_addresses,
+	const DataAddressList& dirty_structure_addresses)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
+	size_t num_dirty_addresses_prev = 0;
 
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for(int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for (int i = 0;
+		 (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size() || num_dirty_addresses_prev != dirty_addresses.size()) &&
+		 i < 10;
+		 i++)
 	{
 		num_dirty_variables_prev = dirty_variables.size();
+		num_dirty_addresses_prev = dirty_addresses.size();
 
 		Vector<DataView*> dirty_views;
 
@@ -107,8 +296,7 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				AddToIndex(view.get());
 
 				views.push_back(std::move(view));
 			}
@@ -117,9 +305,22 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 
 		for (const String& variable_name : dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			auto it = address_index.name_children.find(variable_name);
+			if (it != address_index.name_children.end())
+			{
+				dirty_views.insert(dirty_views.end(), it->second->views.begin(), it->second->views.end());
+				CollectDescendantViews(*it->second, dirty_views);
+			}
+		}
+
+		for (const DataAddress& address : dirty_addresses)
+			CollectDirtyViews(address, dirty_views);
+
+		// Structural changes are only made by the application, thus they only need to be collected once.
+		if (i == 0)
+		{
+			for (const DataAddress& address : dirty_structure_addresses)
+				CollectStructureDirtyViews(address, dirty_views);
 		}
 
 		// Remove duplicate entries
@@ -131,30 +332,40 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		// Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
 		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
 
-		for (DataView* view : dirty_views)
+		// Expressions only read from the data model, so they can be evaluated ahead of the update when enabled for the model. However,
+		// structural views may remove the views sorted after them, or change the entries they refer to. Thus, each run of views between
+		// structural views is evaluated only once the preceding structural view has been updated. Any views rebased by structural views
+		// during the update discard their staged results, and are evaluated again during their own update.
+		const bool parallel_evaluation = model.IsParallelEvaluationEnabled();
+		const int num_dirty_views = (int)dirty_views.size();
+		int evaluated_end = 0;
+
+		for (int j = 0; j < num_dirty_views; j++)
 		{
+			DataView* view = dirty_views[j];
 			RMLUI_ASSERT(view);
 			if (!view)
 				continue;
 
-			if (view->IsValid())
+			if (parallel_evaluation && j >= evaluated_end)
+			{
+				int run_end = j;
+				while (run_end < num_dirty_views && !(dirty_views[run_end] && dirty_views[run_end]->IsStructural()))
+					run_end++;
+
+				EvaluateViewsParallel(model, dirty_views, j, run_end);
+				evaluated_end = run_end + 1;
+			}
+
+			if (IsViewAttached(view, model))
 				result |= view->Update(model);
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
-			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
-			}
+				RemoveFromIndex(view.get());
 
 			views_to_remove.clear();
 		}
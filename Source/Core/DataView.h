@@ -33,12 +33,15 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "DataExpression.h"
 
 namespace Rml {
 
 class Element;
 class DataModel;
 
+using DataAddressList = Vector<DataAddress>;
+
 
 class DataViewInstancer : public NonCopyMoveable {
 public:
@@ -82,8 +85,20 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Evaluates the data expressions of the view ahead of its next update, which then applies the staged results. May be called
+	// concurrently with other views, thus it must only read from the data model and not modify the element or any other shared state.
+	// Returns false if the view does not support staged evaluation, then the view is evaluated during its update as usual.
+	virtual bool Evaluate(DataModel& model);
+
+	// Returns true if the view may add, remove, or rebase the views of its descendant elements during its update. Views sorted after a
+	// structural view are only evaluated ahead of their update once the structural view has been updated.
+	virtual bool IsStructural() const;
+
+	// Returns the list of data variable address(es) which can modify this view.
+	virtual DataAddressList GetVariableAddressList() const = 0;
+
+	// Rebases the variable addresses of this view, called when the view is located within a moved data-for row.
+	virtual void RebaseAddresses(const DataAddressRebaseList& rebases) = 0;
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -108,6 +123,13 @@ private:
 
 
 
+// Node in the index of views by their variable addresses, each node represents an address entry below its parent node.
+struct DataViewAddressNode {
+	Vector<DataView*> views;
+	UnorderedMap<String, UniquePtr<DataViewAddressNode>> name_children;
+	UnorderedMap<int, UniquePtr<DataViewAddressNode>> index_children;
+};
+
 class DataViews : NonCopyMoveable {
 public:
 	DataViews();
@@ -117,9 +139,26 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Rebases the views located within the elements of the rebase map, and moves them accordingly in the address index.
+	void RebaseAddresses(const DataAddressRebaseMap& rebase_map);
+
+	// Updates the views affected by the given dirty variables and addresses. A view is affected by a dirty address when either one
+	// of its variable addresses or the dirty address is a prefix of the other. A view is affected by a dirty structure address when one
+	// of its variable addresses is a prefix of the structure address, or refers to its size.
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const DataAddressList& dirty_addresses,
+		const DataAddressList& dirty_structure_addresses);
 
 private:
+	using AddressNode = DataViewAddressNode;
+
+	void AddToIndex(DataView* view);
+	void RemoveFromIndex(DataView* view);
+
+	// Adds the views affected by the given dirty address.
+	void CollectDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const;
+	// Adds the views affected by the given dirty structure address, the views of its entries are not affected.
+	void CollectStructureDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const;
+
 	using DataViewList = Vector<DataViewPtr>;
 
 	DataViewList views;
@@ -127,8 +166,7 @@ private:
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	AddressNode address_index;
 };
 
 } // namespace Rml
@@ -29,17 +29,27 @@
 #include "DataViewDefault.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "ElementAccess.h"
 #include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
 
 namespace Rml {
 
+// Number of rows constructed above and below the viewport of virtualized data-for views.
+static constexpr int VirtualRowsMargin = 4;
+
 // Some data views need to offset the update order for proper behavior.
 //  'data-value' may need other attributes applied first, eg. min/max attributes.
 static constexpr int SortOffset_DataValue = 100;
@@ -63,18 +73,43 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const {
+DataAddressList DataViewCommon::GetVariableAddressList() const {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	return expression->GetVariableAddressList();
+}
+
+bool DataViewCommon::Evaluate(DataModel& model)
+{
+	RMLUI_ASSERT(expression);
+	DataExpressionInterface expr_interface(&model, GetElement());
+	staged_result = expression->Run(expr_interface, staged_value);
+	has_staged_value = true;
+	return true;
+}
+
+void DataViewCommon::RebaseAddresses(const DataAddressRebaseList& rebases) {
+	RMLUI_ASSERT(expression);
+	expression->RebaseAddresses(rebases);
+	has_staged_value = false;
 }
 
 const String& DataViewCommon::GetModifier() const {
 	return modifier;
 }
 
-DataExpression& DataViewCommon::GetExpression() {
+bool DataViewCommon::RunExpression(DataModel& model, Element* element, Variant& out_value)
+{
 	RMLUI_ASSERT(expression);
-	return *expression;
+	if (has_staged_value)
+	{
+		has_staged_value = false;
+		out_value = std::move(staged_value);
+		staged_value.Clear();
+		return staged_result;
+	}
+
+	DataExpressionInterface expr_interface(&model, element);
+	return expression->Run(expr_interface, out_value);
 }
 
 void DataViewCommon::Release()
@@ -95,9 +130,8 @@ bool DataViewAttribute::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const String value = variant.Get<String>();
 		const Variant* attribute = element->GetAttribute(attribute_name);
@@ -121,9 +155,8 @@ bool DataViewAttributeIf::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const bool value = variant.Get<bool>();
 		const bool is_set = static_cast<bool>(element->GetAttribute(attribute_name));
@@ -151,9 +184,8 @@ bool DataViewChecked::Update(DataModel & model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		bool new_checked_state = false;
 
@@ -192,9 +224,8 @@ bool DataViewStyle::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 	
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const String value = variant.Get<String>();
 		const Property* p = element->GetLocalProperty(property_name);
@@ -217,9 +248,8 @@ bool DataViewClass::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const bool activate = variant.Get<bool>();
 		const bool is_set = element->IsClassSet(class_name);
@@ -241,9 +271,8 @@ bool DataViewRml::Update(DataModel & model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		String new_rml = variant.Get<String>();
 		if (new_rml != previous_rml)
@@ -265,9 +294,8 @@ bool DataViewIf::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const bool value = variant.Get<bool>();
 		const bool is_visible = (element->GetLocalStyleProperties().count(PropertyId::Display) == 0);
@@ -292,9 +320,8 @@ bool DataViewVisible::Update(DataModel& model)
 	bool result = false;
 	Variant variant;
 	Element* element = GetElement();
-	DataExpressionInterface expr_interface(&model, element);
 
-	if (element && GetExpression().Run(expr_interface, variant))
+	if (element && RunExpression(model, element, variant))
 	{
 		const bool value = variant.Get<bool>();
 		const bool is_visible = (element->GetLocalStyleProperties().count(PropertyId::Visibility) == 0);
@@ -390,11 +417,24 @@ bool DataViewText::Update(DataModel& model)
 		Element* element = GetElement();
 		DataExpressionInterface expression_interface(&model, element);
 
+		const bool use_staged_values = has_staged_values;
+		has_staged_values = false;
+
 		for (DataEntry& entry : data_entries)
 		{
 			RMLUI_ASSERT(entry.data_expression);
 			Variant variant;
-			bool result = entry.data_expression->Run(expression_interface, variant);
+			bool result = false;
+			if (use_staged_values)
+			{
+				result = entry.staged_result;
+				variant = std::move(entry.staged_value);
+				entry.staged_value.Clear();
+			}
+			else
+			{
+				result = entry.data_expression->Run(expression_interface, variant);
+			}
 			const String value = variant.Get<String>();
 			if (result && entry.value != value)
 			{
@@ -429,16 +469,30 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+bool DataViewText::Evaluate(DataModel& model)
 {
-	StringList full_list;
+	DataExpressionInterface expression_interface(&model, GetElement());
+
+	for (DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		entry.staged_result = entry.data_expression->Run(expression_interface, entry.staged_value);
+	}
+
+	has_staged_values = true;
+	return true;
+}
+
+DataAddressList DataViewText::GetVariableAddressList() const
+{
+	DataAddressList full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
+		DataAddressList entry_list = entry.data_expression->GetVariableAddressList();
 		full_list.insert(full_list.end(),
 			MakeMoveIterator(entry_list.begin()),
 			MakeMoveIterator(entry_list.end())
@@ -448,6 +502,16 @@ StringList DataViewText::GetVariableNameList() const
 	return full_list;
 }
 
+void DataViewText::RebaseAddresses(const DataAddressRebaseList& rebases)
+{
+	for (DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		entry.data_expression->RebaseAddresses(rebases);
+	}
+	has_staged_values = false;
+}
+
 void DataViewText::Release()
 {
 	delete this;
@@ -482,6 +546,17 @@ String DataViewText::BuildText() const
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0)
 {}
 
+DataViewFor::~DataViewFor()
+{
+	if (Element* container = scroll_container.get())
+	{
+		container->RemoveEventListener(EventId::Scroll, this);
+		container->RemoveEventListener(EventId::Resize, this);
+	}
+
+	RemoveSpacers();
+}
+
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
 {
 	rml_contents = in_rml_content;
@@ -528,26 +603,73 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
-	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
+	// The key must be given relative to the iterator, eg. 'it' or 'it.id'. We resolve it as an entry of the container to find the address entries below it.
+	const String key_str = element->GetAttribute<String>("data-key", String());
+	if (!key_str.empty())
+	{
+		const bool relative_to_iterator = (key_str.compare(0, iterator_name.size(), iterator_name) == 0 &&
+			(key_str.size() == iterator_name.size() || key_str[iterator_name.size()] == '.' || key_str[iterator_name.size()] == '['));
 
-	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
-	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+		const DataAddress key_entry_address =
+			(relative_to_iterator ? model.ResolveAddress(container_name + "[0]" + key_str.substr(iterator_name.size()), element) : DataAddress());
+
+		if (key_entry_address.size() < container_address.size() + 1)
+		{
+			Log::Message(Log::LT_WARNING, "Invalid key '%s' in data-for, the key must refer to the iterator '%s'.", key_str.c_str(), iterator_name.c_str());
+			return false;
+		}
+
+		use_keys = true;
+		key_address.assign(key_entry_address.begin() + container_address.size() + 1, key_entry_address.end());
+	}
+
+	// Virtualized rows are constructed only where they intersect the viewport of the parent scroll container, as the rows scroll.
+	const String virtual_str = element->GetAttribute<String>("data-virtual", String());
+	if (!virtual_str.empty())
 	{
-		if (it->first == "data-for")
+		PropertyDictionary properties;
+		const Property* property = nullptr;
+		if (StyleSheetSpecification::ParsePropertyDeclaration(properties, "height", virtual_str))
+			property = properties.GetProperty(PropertyId::Height);
+
+		if (!property || !(property->unit & Property::ABSOLUTE_LENGTH) || property->Get<float>() <= 0.f)
+		{
+			Log::Message(Log::LT_WARNING, "Invalid row height '%s' in data-virtual, expected a positive absolute length.", virtual_str.c_str());
+			return false;
+		}
+
+		if (use_keys)
 		{
-			attributes.erase(it);
-			break;
+			Log::Message(Log::LT_WARNING, "The data-key attribute '%s' is ignored with data-virtual, virtualized rows are matched by index.",
+				key_str.c_str());
+			use_keys = false;
+			key_address.clear();
 		}
+
+		use_virtual_rows = true;
+		virtual_row_height = *property;
+
+		Element* parent = element->GetParentNode();
+		scroll_container = parent->GetObserverPtr();
+		parent->AddEventListener(EventId::Scroll, this);
+		parent->AddEventListener(EventId::Resize, this);
 	}
 
+	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
+
+	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
+	attributes = element->GetAttributes();
+	attributes.erase("data-for");
+	attributes.erase("data-key");
+	attributes.erase("data-virtual");
+
 	return true;
 }
 
 
 bool DataViewFor::Update(DataModel& model)
 {
-	DataVariable variable = model.GetVariable(container_address);
+	DataVariable variable = model.GetVariable(container_address, container_cache);
 	if (!variable)
 		return false;
 
@@ -556,48 +678,198 @@ bool DataViewFor::Update(DataModel& model)
 	const int num_elements = (int)elements.size();
 	Element* element = GetElement();
 
-	for (int i = 0; i < Math::Max(size, num_elements); i++)
+	if (use_virtual_rows)
 	{
-		if (i >= num_elements)
-		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+		UpdateVirtualRows(model, size);
+		return result;
+	}
+
+	if (!use_keys)
+	{
+		DirtyStructureChangedRows(model, 0, Math::Min(num_elements, size));
+
+		for (int i = num_elements; i < size; i++)
+			elements.push_back(CreateRow(model, i, element));
+
+		for (int i = size; i < num_elements; i++)
+			RemoveRow(elements[i]);
 
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
+		if (num_elements > size)
+			elements.resize(size);
 
-			DataAddress iterator_index_address = {
-				{"literal"}, {"int"}, {i}
-			};
+		return result;
+	}
+
+	StringList keys(size);
+	for (int i = 0; i < size; i++)
+		keys[i] = GetRowKey(model, i);
+
+	// Match the existing rows to the new entries by their keys. With duplicate keys, only the first row of each key is matched.
+	UnorderedMap<String, int> old_key_indices;
+	old_key_indices.reserve(num_elements);
+	for (int i = 0; i < num_elements; i++)
+		old_key_indices.emplace(element_keys[i], i);
+
+	ElementList new_elements(size, nullptr);
+	DataAddressRebaseMap rebase_map;
+
+	for (int i = 0; i < size; i++)
+	{
+		auto it = old_key_indices.find(keys[i]);
+		if (it == old_key_indices.end())
+			continue;
+
+		const int old_index = it->second;
+		old_key_indices.erase(it);
+
+		new_elements[i] = elements[old_index];
+		elements[old_index] = nullptr;
+
+		if (old_index != i)
+			rebase_map.emplace(new_elements[i], GetRowRebases(old_index, i));
+	}
+
+	for (Element* row : elements)
+	{
+		if (row)
+			RemoveRow(row);
+	}
 
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+	PlaceRows(model, new_elements, 0, rebase_map, element);
 
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
+	elements = std::move(new_elements);
+	element_keys = std::move(keys);
+
+	return result;
+}
+
+void DataViewFor::UpdateVirtualRows(DataModel& model, int size)
+{
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	if (!top_spacer || !bottom_spacer)
+	{
+		RemoveSpacers();
+		top_spacer = parent->InsertBefore(CreateSpacer(), element)->GetObserverPtr();
+		bottom_spacer = parent->InsertBefore(CreateSpacer(), element)->GetObserverPtr();
+	}
+
+	// The row height is resolved on every update, so that the rows follow changes to the density ratio and viewport.
+	const float row_height = Math::Max(element->ResolveNumericProperty(&virtual_row_height, 0.f), 1.f);
+
+	// Before the scroll container is formatted, assume that it may cover the whole context.
+	float viewport_height = parent->GetClientHeight();
+	if (viewport_height <= 0.f)
+	{
+		if (Context* context = element->GetContext())
+			viewport_height = float(context->GetDimensions().y);
+	}
 
-			elements[i]->SetInnerRML(rml_contents);
+	const float scroll_top = parent->GetScrollTop();
+	const int new_first_index = Math::Clamp(int(scroll_top / row_height) - VirtualRowsMargin, 0, size);
+	const int new_last_index = Math::Clamp(int(Math::RoundUpFloat((scroll_top + viewport_height) / row_height)) + VirtualRowsMargin, new_first_index, size);
 
-			RMLUI_ASSERT(i < (int)elements.size());
+	// Keep the rows still inside the range, and rebind the rows leaving the range to the entries entering it.
+	ElementList new_elements(new_last_index - new_first_index, nullptr);
+	ElementList spare_rows;
+	Vector<int> spare_row_indices;
+
+	for (int i = 0; i < (int)elements.size(); i++)
+	{
+		const int index = first_row_index + i;
+		if (index >= new_first_index && index < new_last_index)
+		{
+			new_elements[index - new_first_index] = elements[i];
 		}
-		if (i >= size)
+		else
 		{
-			model.EraseAliases(elements[i]);
-			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
-			elements[i] = nullptr;
+			spare_rows.push_back(elements[i]);
+			spare_row_indices.push_back(index);
 		}
 	}
 
-	if (num_elements > size)
-		elements.resize(size);
+	DirtyStructureChangedRows(model, Math::Max(first_row_index, new_first_index), Math::Min(first_row_index + (int)elements.size(), new_last_index));
 
-	return result;
+	DataAddressRebaseMap rebase_map;
+
+	for (int i = 0; i < (int)new_elements.size() && !spare_rows.empty(); i++)
+	{
+		if (new_elements[i])
+			continue;
+
+		const int index = new_first_index + i;
+		new_elements[i] = spare_rows.back();
+		rebase_map.emplace(new_elements[i], GetRowRebases(spare_row_indices.back(), index));
+		model.DirtyAddress(GetIteratorAddress(index));
+
+		spare_rows.pop_back();
+		spare_row_indices.pop_back();
+	}
+
+	for (Element* row : spare_rows)
+		RemoveRow(row);
+
+	PlaceRows(model, new_elements, new_first_index, rebase_map, bottom_spacer.get());
+
+	elements = std::move(new_elements);
+	first_row_index = new_first_index;
+
+	top_spacer->SetProperty(PropertyId::Height, Property(float(new_first_index) * row_height, Property::PX));
+	bottom_spacer->SetProperty(PropertyId::Height, Property(float(size - new_last_index) * row_height, Property::PX));
+}
+
+void DataViewFor::PlaceRows(DataModel& model, ElementList& new_elements, int first_index, const DataAddressRebaseMap& rebase_map, Element* end_element)
+{
+	// Move the views of the reused rows to their new entries, and then the rows themselves. Views of the index alias need to be
+	// updated, while views of the entry itself are only updated if the entry was dirtied.
+	model.RebaseAddresses(rebase_map);
+	for (auto& pair : rebase_map)
+	{
+		const DataAddress& new_index_address = pair.second.back().to;
+		model.DirtyAddress(new_index_address);
+	}
+
+	if (!rebase_map.empty())
+	{
+		ElementList ordered_rows;
+		ordered_rows.reserve(new_elements.size());
+		for (Element* row : new_elements)
+		{
+			if (row)
+				ordered_rows.push_back(row);
+		}
+
+		ElementAccess::ReorderChildren(end_element->GetParentNode(), ordered_rows);
+	}
+
+	// Construct rows for the new entries, each one placed before the row of the next entry.
+	Element* next_row = end_element;
+	for (int i = (int)new_elements.size() - 1; i >= 0; i--)
+	{
+		if (!new_elements[i])
+			new_elements[i] = CreateRow(model, first_index + i, next_row);
+
+		next_row = new_elements[i];
+	}
 }
 
-StringList DataViewFor::GetVariableNameList() const {
+bool DataViewFor::IsStructural() const {
+	return true;
+}
+
+DataAddressList DataViewFor::GetVariableAddressList() const {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{ container_address.front().name };
+	return DataAddressList{ container_address };
+}
+
+void DataViewFor::RebaseAddresses(const DataAddressRebaseList& rebases)
+{
+	if (RebaseDataAddress(container_address, rebases))
+	{
+		container_cache.Clear();
+		key_cache.Clear();
+	}
 }
 
 void DataViewFor::Release()
@@ -605,4 +877,170 @@ void DataViewFor::Release()
 	delete this;
 }
 
+void DataViewFor::ProcessEvent(Event& /*event*/)
+{
+	Element* element = GetElement();
+	DataModel* model = (element ? element->GetDataModel() : nullptr);
+	if (!model)
+		return;
+
+	if (DataVariable variable = model->GetVariable(container_address, container_cache))
+		UpdateVirtualRows(*model, variable.Size());
+}
+
+String DataViewFor::GetRowKey(DataModel& model, int index)
+{
+	DataAddress address = GetIteratorAddress(index);
+	address.insert(address.end(), key_address.begin(), key_address.end());
+
+	// The key addresses of all rows differ only by their index, thus they can share the cache.
+	Variant key;
+	if (DataVariable variable = model.GetVariable(address, key_cache))
+		variable.Get(key);
+
+	return key.Get<String>();
+}
+
+Element* DataViewFor::CreateRow(DataModel& model, int index, Element* adjacent_element)
+{
+	Element* element = GetElement();
+
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	model.InsertAlias(new_element_ptr.get(), iterator_name, GetIteratorAddress(index));
+	model.InsertAlias(new_element_ptr.get(), iterator_index_name, GetIndexAddress(index));
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), adjacent_element);
+
+	InstanceRowContents(new_element);
+
+	return new_element;
+}
+
+ElementPtr DataViewFor::CreateSpacer() const
+{
+	ElementPtr spacer = Factory::InstanceElement(nullptr, "div", "div", XMLAttributes());
+	spacer->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+	return spacer;
+}
+
+void DataViewFor::RemoveSpacers()
+{
+	// The spacers are owned by the parent of the data-for element, they may already have been destroyed along with it.
+	for (ObserverPtr<Element>* spacer : { &top_spacer, &bottom_spacer })
+	{
+		if (Element* spacer_element = spacer->get())
+		{
+			if (Element* parent = spacer_element->GetParentNode())
+				parent->RemoveChild(spacer_element);
+		}
+		spacer->reset();
+	}
+}
+
+void DataViewFor::RemoveRow(Element* row)
+{
+	// The data model releases all aliases and views of the row as it is removed from the document.
+	row->GetParentNode()->RemoveChild(row);
+}
+
+void DataViewFor::DirtyStructureChangedRows(DataModel& model, int begin_index, int end_index) const
+{
+	// When only the structure of the container is dirtied, the rows matched by index may now refer to different entries. Otherwise,
+	// the rows are already dirty along with the container, or their entries are unchanged.
+	if (!model.IsStructureDirty(container_address))
+		return;
+
+	for (int i = begin_index; i < end_index; i++)
+		model.DirtyAddress(GetIteratorAddress(i));
+}
+
+void DataViewFor::InstanceRowContents(Element* row)
+{
+	RMLUI_ZoneScoped;
+
+	if (!row_template_recorded)
+	{
+		// Records the parse events of the row contents instead of constructing any elements.
+		class TemplateRecorder final : public XMLParser {
+		public:
+			TemplateRecorder(Vector<TemplateEvent>& events) : XMLParser(nullptr), events(events) {}
+
+			void HandleElementStart(const String& name, const XMLAttributes& attributes) override {
+				events.push_back(TemplateEvent{TemplateEvent::Type::ElementStart, name, attributes, XMLDataType::Text});
+			}
+			void HandleElementEnd(const String& name) override {
+				events.push_back(TemplateEvent{TemplateEvent::Type::ElementEnd, name, XMLAttributes(), XMLDataType::Text});
+			}
+			void HandleData(const String& data, XMLDataType type) override {
+				events.push_back(TemplateEvent{TemplateEvent::Type::Data, data, XMLAttributes(), type});
+			}
+
+		private:
+			Vector<TemplateEvent>& events;
+		};
+
+		row_template_recorded = true;
+
+		String text;
+		if (SystemInterface* system_interface = GetSystemInterface())
+			system_interface->TranslateString(text, rml_contents);
+
+		// Wrap the contents in the base tag, as is done when setting the inner RML of an element.
+		Context* context = row->GetContext();
+		const String tag = context ? context->GetDocumentsBaseTag() : "body";
+		const String open_tag = "<" + tag + ">";
+		const String close_tag = "</" + tag + ">";
+
+		StreamMemory stream(open_tag.size() + text.size() + close_tag.size());
+		stream.Write(open_tag.c_str(), open_tag.size());
+		stream.Write(text);
+		stream.Write(close_tag.c_str(), close_tag.size());
+		stream.Seek(0, SEEK_SET);
+
+		TemplateRecorder recorder(row_template);
+		recorder.Parse(&stream);
+	}
+
+	// The handlers are only public through the base parser.
+	XMLParser xml_parser(row);
+	BaseXMLParser& parser = xml_parser;
+	for (const TemplateEvent& event : row_template)
+	{
+		switch (event.type)
+		{
+		case TemplateEvent::Type::ElementStart: parser.HandleElementStart(event.value, event.attributes); break;
+		case TemplateEvent::Type::ElementEnd: parser.HandleElementEnd(event.value); break;
+		case TemplateEvent::Type::Data: parser.HandleData(event.value, event.data_type); break;
+		}
+	}
+}
+
+DataAddress DataViewFor::GetIteratorAddress(int index) const
+{
+	DataAddress address;
+	address.reserve(container_address.size() + 1);
+	address = container_address;
+	address.push_back(DataAddressEntry(index));
+	return address;
+}
+
+DataAddress DataViewFor::GetIndexAddress(int index) const
+{
+	// The container address is appended to the index literal, so that the index can be rebased independently of the indices of other loops.
+	DataAddress address = {
+		{"literal"}, {"int"}, {index}
+	};
+	address.insert(address.end(), container_address.begin(), container_address.end());
+	return address;
+}
+
+DataAddressRebaseList DataViewFor::GetRowRebases(int old_index, int new_index) const
+{
+	return DataAddressRebaseList{
+		DataAddressRebase{ GetIteratorAddress(old_index), GetIteratorAddress(new_index) },
+		DataAddressRebase{ GetIndexAddress(old_index), GetIndexAddress(new_index) },
+	};
+}
+
 } // namespace Rml
@@ -31,6 +31,8 @@
 
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
 
@@ -47,11 +49,17 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	bool Evaluate(DataModel& model) override;
+
+	DataAddressList GetVariableAddressList() const override;
+
+	void RebaseAddresses(const DataAddressRebaseList& rebases) override;
 
 protected:
 	const String& GetModifier() const;
-	DataExpression& GetExpression();
+
+	// Runs the expression, or takes the result staged by a previous call to Evaluate().
+	bool RunExpression(DataModel& model, Element* element, Variant& out_value);
 
 	// Delete this
 	void Release() override;
@@ -59,6 +67,10 @@ protected:
 private:
 	String modifier;
 	DataExpressionPtr expression;
+
+	bool has_staged_value = false;
+	bool staged_result = false;
+	Variant staged_value;
 };
 
 
@@ -139,7 +151,10 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+	bool Evaluate(DataModel& model) override;
+	DataAddressList GetVariableAddressList() const override;
+
+	void RebaseAddresses(const DataAddressRebaseList& rebases) override;
 
 protected:
 	void Release() override;
@@ -151,34 +166,94 @@ private:
 		size_t index = 0; // Index into 'text'
 		DataExpressionPtr data_expression;
 		String value;
+		bool staged_result = false;
+		Variant staged_value;
 	};
 
 	String text;
 	Vector<DataEntry> data_entries;
+	bool has_staged_values = false;
 };
 
 
-class DataViewFor final : public DataView {
+// Repeats the element for each entry of an array variable. Rows are matched to the entries by index, or by the key given in
+// the optional 'data-key' attribute, eg. 'data-key="it.id"', in which case rows are moved along with their entries.
+// With the 'data-virtual' attribute giving the row height as an absolute length, eg. 'data-virtual="20px"', only the rows intersecting the
+// viewport of the parent scroll container are constructed, and the rows are rebound to other entries as the container scrolls.
+// Virtualized rows are always matched by index, thus they cannot be combined with 'data-key'.
+class DataViewFor final : public DataView, private EventListener {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor();
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& inner_rml) override;
 
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	bool IsStructural() const override;
+
+	DataAddressList GetVariableAddressList() const override;
+
+	void RebaseAddresses(const DataAddressRebaseList& rebases) override;
 
 protected:
 	void Release() override;
 
 private:
+	// Responds to 'scroll' and 'resize' events on the scroll container of virtualized rows.
+	void ProcessEvent(Event& event) override;
+
+	// A recorded parse event of the row contents.
+	struct TemplateEvent {
+		enum class Type { ElementStart, ElementEnd, Data };
+		Type type;
+		String value;
+		XMLAttributes attributes;
+		XMLDataType data_type;
+	};
+
+	String GetRowKey(DataModel& model, int index);
+	void UpdateVirtualRows(DataModel& model, int size);
+	// Places the given rows in order before the end element, constructs any missing rows, and moves the views of the rebased rows.
+	void PlaceRows(DataModel& model, ElementList& new_elements, int first_index, const DataAddressRebaseMap& rebase_map, Element* end_element);
+	Element* CreateRow(DataModel& model, int index, Element* adjacent_element);
+	ElementPtr CreateSpacer() const;
+	// Removes the spacers of virtualized rows from the parent, if they still exist.
+	void RemoveSpacers();
+	void RemoveRow(Element* row);
+	// Dirties the rows in the given index range if only the structure of the container was dirtied.
+	void DirtyStructureChangedRows(DataModel& model, int begin_index, int end_index) const;
+	void InstanceRowContents(Element* row);
+	DataAddress GetIteratorAddress(int index) const;
+	DataAddress GetIndexAddress(int index) const;
+	DataAddressRebaseList GetRowRebases(int old_index, int new_index) const;
+
 	DataAddress container_address;
+	DataAddressCache container_cache;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
 	ElementAttributes attributes;
 
+	// Rows are matched by key when enabled, the key address is given relative to the row's entry.
+	bool use_keys = false;
+	DataAddress key_address;
+	DataAddressCache key_cache;
+
+	// Row height when the rows are virtualized, in units not depending on the font size, eg. 'px' or 'dp'.
+	bool use_virtual_rows = false;
+	Property virtual_row_height;
+	ObserverPtr<Element> scroll_container;
+	ObserverPtr<Element> top_spacer;
+	ObserverPtr<Element> bottom_spacer;
+
+	// The rows in order, starting at the entry with the given index.
 	ElementList elements;
+	StringList element_keys;
+	int first_row_index = 0;
+
+	bool row_template_recorded = false;
+	Vector<TemplateEvent> row_template;
 };
 
 } // namespace Rml
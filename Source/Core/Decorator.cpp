@@ -42,6 +42,11 @@ Decorator::~Decorator()
 {
 }
 
+bool Decorator::IsOpacityDependent() const
+{
+	return true;
+}
+
 int Decorator::AddTexture(const Texture& texture)
 {
 	if (!texture)
@@ -71,7 +71,6 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 	const Box& box = element->GetBox();
 
 	const ComputedValues& computed = element->GetComputedValues();
-	const float opacity = computed.opacity();
 
 	const Vector4f border_radius{
 		computed.border_top_left_radius(),
@@ -81,12 +80,6 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 	};
 	GeometryUtilities::GenerateBackgroundBorder(geometry, element->GetBox(), Vector2f(0), border_radius, Colourb());
 
-	// Apply opacity
-	Colourb colour_start = start;
-	colour_start.alpha = (byte)(opacity * (float)colour_start.alpha);
-	Colourb colour_stop = stop;
-	colour_stop.alpha = (byte)(opacity * (float)colour_stop.alpha);
-
 	const Vector2f padding_offset = box.GetPosition(Box::PADDING);
 	const Vector2f padding_size = box.GetSize(Box::PADDING);
 
@@ -97,7 +90,7 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 		for (int i = 0; i < (int)vertices.size(); i++)
 		{
 			const float t = Math::Clamp((vertices[i].position.x - padding_offset.x) / padding_size.x, 0.0f, 1.0f);
-			vertices[i].colour = Math::RoundedLerp(t, colour_start, colour_stop);
+			vertices[i].colour = Math::RoundedLerp(t, start, stop);
 		}
 	}
 	else if (dir == Direction::Vertical)
@@ -105,7 +98,7 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 		for (int i = 0; i < (int)vertices.size(); i++)
 		{
 			const float t = Math::Clamp((vertices[i].position.y - padding_offset.y) / padding_size.y, 0.0f, 1.0f);
-			vertices[i].colour = Math::RoundedLerp(t, colour_start, colour_stop);
+			vertices[i].colour = Math::RoundedLerp(t, start, stop);
 		}
 	}
 
@@ -120,9 +113,15 @@ void DecoratorGradient::ReleaseElementData(DecoratorDataHandle element_data) con
 void DecoratorGradient::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	auto* data = reinterpret_cast<Geometry*>(element_data);
+	data->SetColourMultiplier(Colourb(255, 255, 255, byte(element->GetComputedValues().opacity() * 255.f)));
 	data->Render(element->GetAbsoluteOffset(Box::BORDER));
 }
 
+bool DecoratorGradient::IsOpacityDependent() const
+{
+	return false;
+}
+
 //=======================================================
 
 DecoratorGradientInstancer::DecoratorGradientInstancer()
@@ -70,10 +70,8 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 	const Vector2f surface_dimensions = element->GetBox().GetSize(Box::PADDING).Round();
 
-	const float opacity = computed.opacity();
-	Colourb quad_colour = computed.image_color();
-
-	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	// Opacity is applied as a colour multiplier when rendering.
+	const Colourb quad_colour = computed.image_color();
 
 
 	/* In the following, we operate on the four diagonal vertices in the grid, as they define the whole grid. */
@@ -180,9 +178,15 @@ void DecoratorNinePatch::ReleaseElementData(DecoratorDataHandle element_data) co
 void DecoratorNinePatch::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Geometry* data = reinterpret_cast< Geometry* >(element_data);
+	data->SetColourMultiplier(Colourb(255, 255, 255, byte(element->GetComputedValues().opacity() * 255.f)));
 	data->Render(element->GetAbsoluteOffset(Box::PADDING));
 }
 
+bool DecoratorNinePatch::IsOpacityDependent() const
+{
+	return false;
+}
+
 
 
 DecoratorNinePatchInstancer::DecoratorNinePatchInstancer()
@@ -44,6 +44,11 @@ DecoratorTiled::~DecoratorTiled()
 {
 }
 
+bool DecoratorTiled::IsOpacityDependent() const
+{
+	return false;
+}
+
 static const Vector2f oriented_texcoords[4][2] = {
 	{Vector2f(0, 0), Vector2f(1, 1)},   // ORIENTATION_NONE
 	{Vector2f(1, 0), Vector2f(0, 1)},   // FLIP_HORIZONTAL
@@ -118,11 +123,8 @@ void DecoratorTiled::Tile::GenerateGeometry(Vector< Vertex >& vertices, Vector<
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	float opacity = computed.opacity();
-	Colourb quad_colour = computed.image_color();
-
-    // Apply opacity
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	// Opacity is applied as a colour multiplier when rendering.
+	const Colourb quad_colour = computed.image_color();
 
 	auto data_iterator = data.find(render_interface);
 	if (data_iterator == data.end())
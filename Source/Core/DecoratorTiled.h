@@ -49,6 +49,9 @@ public:
 	DecoratorTiled();
 	virtual ~DecoratorTiled();
 
+	// Tiled decorators apply the opacity as a colour multiplier when rendering.
+	bool IsOpacityDependent() const override;
+
 	/**
 		Stores the orientation of a tile.
 	 */
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledBox.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 
@@ -302,8 +303,14 @@ void DecoratorTiledBox::RenderElement(Element* element, DecoratorDataHandle elem
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
 	DecoratorTiledBoxData* data = reinterpret_cast< DecoratorTiledBoxData* >(element_data);
 
+	// Opacity is applied as a colour multiplier, so that changing it does not require the geometry to be generated again.
+	const Colourb colour_multiplier(255, 255, 255, byte(element->GetComputedValues().opacity() * 255.f));
+
 	for (int i = 0; i < data->num_textures; i++)
+	{
+		data->geometry[i].SetColourMultiplier(colour_multiplier);
 		data->geometry[i].Render(translation);
+	}
 }
 
 } // namespace Rml
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledHorizontal.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/Texture.h"
@@ -150,8 +151,14 @@ void DecoratorTiledHorizontal::RenderElement(Element* element, DecoratorDataHand
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
 	DecoratorTiledHorizontalData* data = reinterpret_cast< DecoratorTiledHorizontalData* >(element_data);
 
+	// Opacity is applied as a colour multiplier, so that changing it does not require the geometry to be generated again.
+	const Colourb colour_multiplier(255, 255, 255, byte(element->GetComputedValues().opacity() * 255.f));
+
 	for (int i = 0; i < data->num_textures; i++)
+	{
+		data->geometry[i].SetColourMultiplier(colour_multiplier);
 		data->geometry[i].Render(translation);
+	}
 }
 
 } // namespace Rml
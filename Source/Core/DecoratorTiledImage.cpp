@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledImage.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -73,6 +74,7 @@ void DecoratorTiledImage::ReleaseElementData(DecoratorDataHandle element_data) c
 void DecoratorTiledImage::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Geometry* data = reinterpret_cast< Geometry* >(element_data);
+	data->SetColourMultiplier(Colourb(255, 255, 255, byte(element->GetComputedValues().opacity() * 255.f)));
 	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
 }
 
@@ -42,7 +42,9 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -102,6 +104,10 @@ struct ElementMeta
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+
+	// Children which most recently computed their values, subsequent siblings may share the computed values of these elements.
+	static constexpr int num_style_sharing_candidates = 2;
+	Element* style_sharing_candidates[num_style_sharing_candidates] = {};
 };
 
 static Pool< ElementMeta > element_meta_chunk_pool(200, true);
@@ -109,7 +115,7 @@ static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
 	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
-	dirty_transition(false), dirty_transform(false), dirty_perspective(false),
+	dirty_transition(false), dirty_transform(false), dirty_perspective(false), dirty_update(true), dirty_descendant_update(false),
 
 	tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0),
 	content_box(0, 0)
@@ -155,7 +161,7 @@ Element::~Element()
 	element_meta_chunk_pool.DestroyAndDeallocate(meta);
 }
 
-void Element::Update(float dp_ratio, Vector2f vp_dimensions)
+int Element::Update(float dp_ratio, Vector2f vp_dimensions)
 {
 #ifdef RMLUI_ENABLE_PROFILING
 	auto name = GetAddress(false, false);
@@ -163,28 +169,68 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
-	OnUpdate();
-
-	HandleTransitionProperty();
-	HandleAnimationProperty();
-	AdvanceAnimations();
+	int num_updated_elements = 1;
 
-	meta->scroll.Update();
+	if (dirty_update)
+	{
+		// Clear the flag before updating, so that anything dirtied during the update is picked up during the next update loop.
+		dirty_update = false;
 
-	UpdateProperties(dp_ratio, vp_dimensions);
+		OnUpdate();
 
-	// Do en extra pass over the animations and properties if the 'animation' property was just changed.
-	if (dirty_animation)
-	{
+		HandleTransitionProperty();
 		HandleAnimationProperty();
 		AdvanceAnimations();
+
+		meta->scroll.Update();
+
 		UpdateProperties(dp_ratio, vp_dimensions);
+
+		// Do en extra pass over the animations and properties if the 'animation' property was just changed.
+		if (dirty_animation)
+		{
+			HandleAnimationProperty();
+			AdvanceAnimations();
+			UpdateProperties(dp_ratio, vp_dimensions);
+		}
+
+		meta->decoration.InstanceDecorators();
+
+		// Running animations need to be advanced on every update.
+		if (!animations.empty())
+			DirtyUpdate();
 	}
 
-	meta->decoration.InstanceDecorators();
+	if (dirty_descendant_update)
+	{
+		AncestorFilter& ancestor_filter = AncestorFilter::Get();
+		ancestor_filter.Push(this);
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+		UpdateChildDefinitionsParallel();
+
+		for (size_t i = 0; i < children.size(); i++)
+		{
+			Element* child = children[i].get();
+			if (child->dirty_update || child->dirty_descendant_update)
+				num_updated_elements += child->Update(dp_ratio, vp_dimensions);
+		}
+
+		ancestor_filter.Pop(this);
+
+		// The flag is kept during the loop above so that descendants dirtied in the meantime don't propagate further up the hierarchy. Now,
+		// keep it only if any children were dirtied again, such as by running animations, so that they are visited during the next update.
+		dirty_descendant_update = false;
+		for (const ElementPtr& child : children)
+		{
+			if (child->dirty_update || child->dirty_descendant_update)
+			{
+				dirty_descendant_update = true;
+				break;
+			}
+		}
+	}
+
+	return num_updated_elements;
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -196,8 +242,26 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
-		// Compute values and clear dirty properties
-		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values, computed_values_are_default_initialized, dp_ratio, vp_dimensions);
+		PropertyIdSet dirty_properties;
+
+		if (Element* sharing_element = FindStyleSharingElement())
+		{
+			// Share the computed values of an equivalent sibling instead of computing them again.
+			dirty_properties = meta->style.ShareComputedValues(meta->computed_values, sharing_element->meta->computed_values);
+		}
+		else
+		{
+			// Compute values and clear dirty properties
+			meta->computed_values.EnsureUnique();
+			dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values, computed_values_are_default_initialized, dp_ratio, vp_dimensions);
+
+			if (parent)
+			{
+				Element** candidates = parent->meta->style_sharing_candidates;
+				std::move_backward(candidates, candidates + ElementMeta::num_style_sharing_candidates - 1, candidates + ElementMeta::num_style_sharing_candidates);
+				candidates[0] = this;
+			}
+		}
 
 		computed_values_are_default_initialized = false;
 
@@ -208,6 +272,24 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 	}
 }
 
+Element* Element::FindStyleSharingElement() const
+{
+	if (!parent)
+		return nullptr;
+
+	for (Element* candidate : parent->meta->style_sharing_candidates)
+	{
+		if (candidate && candidate != this && !candidate->computed_values_are_default_initialized &&
+			meta->style.CanShareComputedValues(candidate->meta->style))
+		{
+			RMLUI_ASSERT(candidate->parent == parent);
+			return candidate;
+		}
+	}
+
+	return nullptr;
+}
+
 void Element::Render()
 {
 #ifdef RMLUI_ENABLE_PROFILING
@@ -351,7 +433,7 @@ String Element::GetAddress(bool include_pseudo_classes, bool include_parents) co
 		for (auto& pseudo_class : pseudo_classes)
 		{
 			address += ":";
-			address += pseudo_class.first;
+			address += GetAtomName(pseudo_class.first);
 		}
 	}
 
@@ -474,6 +556,10 @@ void Element::SetBox(const Box& box)
 
 		OnResize();
 
+		// Documents receive resize events from the context. Other elements are notified once the layout of their document is complete.
+		if (owner_document && owner_document != this && meta->event_dispatcher.HasListener(EventId::Resize))
+			owner_document->AddResizedElement(this);
+
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
 		meta->decoration.DirtyDecoratorsData();
@@ -799,7 +885,7 @@ StringList Element::GetActivePseudoClasses() const
 	names.reserve(pseudo_classes.size());
 	for (auto& pseudo_class : pseudo_classes)
 	{
-		names.push_back(pseudo_class.first);
+		names.push_back(GetAtomName(pseudo_class.first));
 	}
 
 	return names;
@@ -1698,6 +1784,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			meta->style.SetId(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1778,7 +1865,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 
 		if (!changed_properties_forcing_layout.Empty())
 		{
-			DirtyLayout();
+			DirtyLayoutFromParent();
 		}
 		else if (top_right_bottom_left_changed)
 		{
@@ -1794,7 +1881,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 				(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
 
 			if (absolutely_positioned && (sized_width || sized_height))
-				DirtyLayout();
+				DirtyLayoutFromParent();
 		}
 	}
 
@@ -1877,8 +1964,6 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 
 	// Dirty the background if it's changed.
     if (border_radius_changed ||
-		changed_properties.Contains(PropertyId::BackgroundColor) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->background_border.DirtyBackground();
@@ -1889,14 +1974,19 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::BorderTopWidth) ||
 		changed_properties.Contains(PropertyId::BorderRightWidth) ||
 		changed_properties.Contains(PropertyId::BorderBottomWidth) ||
-		changed_properties.Contains(PropertyId::BorderLeftWidth) ||
+		changed_properties.Contains(PropertyId::BorderLeftWidth))
+	{
+		meta->background_border.DirtyBorder();
+	}
+
+	// Colour changes can usually be applied to the existing background and border geometry.
+	if (changed_properties.Contains(PropertyId::BackgroundColor) ||
 		changed_properties.Contains(PropertyId::BorderTopColor) ||
 		changed_properties.Contains(PropertyId::BorderRightColor) ||
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
-		changed_properties.Contains(PropertyId::BorderLeftColor) ||
-		changed_properties.Contains(PropertyId::Opacity))
+		changed_properties.Contains(PropertyId::BorderLeftColor))
 	{
-		meta->background_border.DirtyBorder();
+		meta->background_border.DirtyColours();
 	}
 	
 	// Dirty the decoration if it's changed.
@@ -1907,11 +1997,14 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 
 	// Dirty the decoration data when its visual looks may have changed.
 	if (border_radius_changed ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->decoration.DirtyDecoratorsData();
 	}
+	else if (changed_properties.Contains(PropertyId::Opacity))
+	{
+		meta->decoration.DirtyDecoratorsOpacity();
+	}
 
 	// Check for `perspective' and `perspective-origin' changes
 	if (changed_properties.Contains(PropertyId::Perspective) ||
@@ -1934,11 +2027,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		DirtyUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -1958,8 +2053,31 @@ void Element::OnChildRemove(Element* /*child*/)
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	ElementDocument* document = GetOwnerDocument();
+	if (!document || document->IsLayoutDirty())
+		return;
+
+	// Only the contents of the nearest layout boundary need to be formatted again, or otherwise the whole document.
+	for (Element* element = this; element && element != document; element = element->parent)
+	{
+		if (LayoutEngine::IsLayoutBoundary(element))
+		{
+			document->DirtyLayoutBoundary(element);
+			return;
+		}
+	}
+
+	document->DirtyLayout();
+}
+
+void Element::DirtyLayoutFromParent()
+{
+	// Changes to our own box may affect the layout of our parent, thus we start looking for a layout boundary from there. Documents are
+	// always formatted as a whole.
+	if (parent && owner_document != this)
+		parent->DirtyLayout();
+	else
+		DirtyLayout();
 }
 
 bool Element::IsLayoutDirty()
@@ -2115,15 +2233,77 @@ void Element::Release()
 		Log::Message(Log::LT_WARNING, "Leak detected: element %s not instanced via RmlUi Factory. Unable to release.", GetAddress().c_str());
 }
 
+void Element::ReorderChildren(const ElementList& ordered_children)
+{
+	if (ordered_children.size() < 2)
+		return;
+
+	UnorderedSet<Element*> reordered_set(ordered_children.begin(), ordered_children.end());
+
+	Vector<size_t> positions;
+	positions.reserve(ordered_children.size());
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		if (reordered_set.count(children[i].get()) == 1)
+			positions.push_back(i);
+	}
+
+	RMLUI_ASSERTMSG(positions.size() == ordered_children.size(), "All reordered elements must be children of this element.");
+	if (positions.size() != ordered_children.size())
+		return;
+
+	bool changed = false;
+	for (size_t i = 0; i < positions.size(); i++)
+	{
+		if (children[positions[i]].get() != ordered_children[i])
+		{
+			changed = true;
+			break;
+		}
+	}
+
+	if (!changed)
+		return;
+
+	// Release the children from their current positions, then put them back in the new order.
+	UnorderedMap<Element*, ElementPtr> released_children;
+	released_children.reserve(positions.size());
+	for (size_t position : positions)
+	{
+		Element* child = children[position].get();
+		released_children[child] = std::move(children[position]);
+	}
+
+	for (size_t i = 0; i < positions.size(); i++)
+		children[positions[i]] = std::move(released_children[ordered_children[i]]);
+
+	DirtyLayout();
+	DirtyStackingContext();
+	DirtyDefinition(DirtyNodes::Self);
+}
+
 void Element::SetParent(Element* _parent)
 {	
 	// Assumes we are already detached from the hierarchy or we are detaching now.
 	RMLUI_ASSERT(!parent || !_parent);
 
+	if (parent)
+	{
+		for (Element*& candidate : parent->meta->style_sharing_candidates)
+		{
+			if (candidate == this)
+				candidate = nullptr;
+		}
+
+		meta->event_dispatcher.OnDetachFromParent();
+	}
+
 	parent = _parent;
 
 	if (parent)
 	{
+		meta->event_dispatcher.OnAttachToParent();
+
 		// We need to update our definition and make sure we inherit the properties of our new parent.
 		DirtyDefinition(DirtyNodes::Self);
 		meta->style.DirtyInheritedProperties();
@@ -2170,6 +2350,8 @@ void Element::DirtyAbsoluteOffset()
 {
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
+
+	DirtyRender();
 }
 
 void Element::DirtyAbsoluteOffsetRecursive()
@@ -2403,6 +2585,17 @@ void Element::DirtyStackingContext()
 
 	if (stacking_context_parent)
 		stacking_context_parent->stacking_context_dirty = true;
+
+	DirtyRender();
+}
+
+void Element::DirtyRender()
+{
+	if (Context* context = GetContext())
+	{
+		context->render_dirty = true;
+		++context->geometry_generation;
+	}
 }
 
 void Element::DirtyDefinition(DirtyNodes dirty_nodes)
@@ -2415,9 +2608,14 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 	case DirtyNodes::SelfAndSiblings:
 		dirty_definition = true;
 		if (parent)
+		{
 			parent->dirty_child_definitions = true;
+			parent->DirtyUpdate();
+		}
 		break;
 	}
+
+	DirtyUpdate();
 }
 
 void Element::UpdateDefinition()
@@ -2438,8 +2636,89 @@ void Element::UpdateDefinition()
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
 			child->dirty_definition = true;
+			child->DirtyUpdate();
+		}
+	}
+}
+
+void Element::UpdateDefinitionRecursive()
+{
+	UpdateDefinition();
+
+	AncestorFilter& ancestor_filter = AncestorFilter::Get();
+	ancestor_filter.Push(this);
+
+	for (const ElementPtr& child : children)
+	{
+		if (child->dirty_update || child->dirty_descendant_update)
+			child->UpdateDefinitionRecursive();
 	}
+
+	ancestor_filter.Pop(this);
+}
+
+void Element::UpdateChildDefinitionsParallel()
+{
+	// Only worth the overhead when a large number of sibling subtrees need to resolve their definitions, such as after loading a document or
+	// changing the class of a container.
+	static constexpr int min_parallel_subtrees = 8;
+
+	int num_dirty_children = 0;
+	for (const ElementPtr& child : children)
+	{
+		if (child->dirty_definition)
+			num_dirty_children += 1;
+	}
+
+	if (num_dirty_children < min_parallel_subtrees)
+		return;
+
+	SystemInterface* system_interface = ::Rml::GetSystemInterface();
+	if (!system_interface || system_interface->GetNumWorkerThreads() <= 0)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	ElementList dirty_children;
+	dirty_children.reserve(num_dirty_children);
+	for (const ElementPtr& child : children)
+	{
+		if (child->dirty_definition)
+			dirty_children.push_back(child.get());
+	}
+
+	// Each sibling subtree is independent during definition updates: Selector matching only reads from the element hierarchy, and any dirty flags
+	// set during the update are propagated no further than the subtree itself, since our own descendant flag is already set.
+	RMLUI_ASSERT(dirty_descendant_update);
+	system_interface->RunParallelTasks((int)dirty_children.size(), [this, &dirty_children](int i) {
+		// Worker threads start with an empty ancestor filter, while the calling thread may run tasks with its filter already in place.
+		AncestorFilter& ancestor_filter = AncestorFilter::Get();
+		const bool seed_ancestor_filter = !ancestor_filter.IsValidFor(dirty_children[i]);
+		if (seed_ancestor_filter)
+			ancestor_filter.PushAncestorChain(this);
+
+		dirty_children[i]->UpdateDefinitionRecursive();
+
+		if (seed_ancestor_filter)
+		{
+			for (Element* ancestor = this; ancestor; ancestor = ancestor->parent)
+				ancestor_filter.Pop(ancestor);
+		}
+	});
+}
+
+void Element::DirtyUpdate()
+{
+	dirty_update = true;
+	DirtyUpdateAncestors();
+}
+
+void Element::DirtyUpdateAncestors()
+{
+	for (Element* ancestor = parent; ancestor && !ancestor->dirty_descendant_update; ancestor = ancestor->parent)
+		ancestor->dirty_descendant_update = true;
 }
 
 
@@ -2485,6 +2764,8 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 {
 	auto it = std::find_if(animations.begin(), animations.end(), [&](const ElementAnimation& el) { return el.GetPropertyId() == property_id; });
 
+	DirtyUpdate();
+
 	if (it != animations.end())
 	{
 		*it = ElementAnimation{};
@@ -2943,6 +3224,7 @@ void Element::DirtyFontFaceRecursive()
 {
 	// Dirty the font size to force the element to update the face handle during the next Update(), and update any existing text geometry.
 	meta->style.DirtyProperty(PropertyId::FontSize);
+	meta->computed_values.EnsureUnique();
 	meta->computed_values.font_face_handle(0);
 
 	const int num_children = GetNumChildren(true);
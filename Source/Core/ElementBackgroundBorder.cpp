@@ -30,7 +30,7 @@
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
-#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -40,16 +40,20 @@ ElementBackgroundBorder::ElementBackgroundBorder(Element* element) : geometry(el
 
 void ElementBackgroundBorder::Render(Element * element)
 {
-	if (background_dirty || border_dirty)
-	{
+	if (background_dirty || border_dirty || (colours_dirty && !RecolourGeometry(element)))
 		GenerateGeometry(element);
 
-		background_dirty = false;
-		border_dirty = false;
-	}
+	background_dirty = false;
+	border_dirty = false;
+	colours_dirty = false;
 
 	if (geometry)
+	{
+		// Opacity is applied as a colour multiplier, so that changing it does not require the geometry to be generated again.
+		const float opacity = element->GetComputedValues().opacity();
+		geometry.SetColourMultiplier(Colourb(255, 255, 255, byte(opacity * 255.f)));
 		geometry.Render(element->GetAbsoluteOffset(Box::BORDER));
+	}
 }
 
 void ElementBackgroundBorder::DirtyBackground()
@@ -62,39 +66,82 @@ void ElementBackgroundBorder::DirtyBorder()
 	border_dirty = true;
 }
 
-void ElementBackgroundBorder::GenerateGeometry(Element* element)
+void ElementBackgroundBorder::DirtyColours()
 {
-	const ComputedValues& computed = element->GetComputedValues();
+	colours_dirty = true;
+}
 
-	Colourb background_color = computed.background_color();
-	Colourb border_colors[4] = {
-		computed.border_top_color(),
-		computed.border_right_color(),
-		computed.border_bottom_color(),
-		computed.border_left_color(),
-	};
-	
-	// Apply opacity
-	const float opacity = computed.opacity();
-	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
-
-	if (opacity < 1)
+// Returns true if the same vertices are generated with either set of colours, see GeometryBackgroundBorder::Recolour().
+static bool IsSameTopology(const Colourb* colours_a, const Colourb* colours_b)
+{
+	for (int i = 0; i < 5; i++)
 	{
-		for (int i = 0; i < 4; ++i)
-			border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
+		if ((colours_a[i].alpha > 0) != (colours_b[i].alpha > 0))
+			return false;
 	}
 
-	geometry.GetVertices().clear();
-	geometry.GetIndices().clear();
+	for (int corner = 0; corner < 4; corner++)
+	{
+		const int edge0 = 1 + (corner + 3) % 4;
+		const int edge1 = 1 + corner;
+		if ((colours_a[edge0] == colours_a[edge1]) != (colours_b[edge0] == colours_b[edge1]))
+			return false;
+	}
+
+	return true;
+}
+
+static void GetColours(const ComputedValues& computed, Colourb* colours)
+{
+	colours[0] = computed.background_color();
+	colours[1] = computed.border_top_color();
+	colours[2] = computed.border_right_color();
+	colours[3] = computed.border_bottom_color();
+	colours[4] = computed.border_left_color();
+}
+
+bool ElementBackgroundBorder::RecolourGeometry(Element* element)
+{
+	Colourb new_colours[5];
+	GetColours(element->GetComputedValues(), new_colours);
+
+	if (!IsSameTopology(colours, new_colours))
+		return false;
+
+	std::copy(new_colours, new_colours + 5, colours);
+
+	Vector<Vertex>& vertices = geometry.GetVertices();
+	if (vertices.empty())
+		return true;
+
+	GeometryBackgroundBorder::Recolour(vertices, colour_sources, colours[0], colours + 1);
+	geometry.Release();
+
+	return true;
+}
+
+void ElementBackgroundBorder::GenerateGeometry(Element* element)
+{
+	const ComputedValues& computed = element->GetComputedValues();
+
+	GetColours(computed, colours);
+	const Colourb background_color = colours[0];
+	const Colourb* border_colors = colours + 1;
+
+	Vector<Vertex>& vertices = geometry.GetVertices();
+	Vector<int>& indices = geometry.GetIndices();
+	vertices.clear();
+	indices.clear();
+	colour_sources.clear();
 
-	const Vector4f radii(computed.border_top_left_radius(), computed.border_top_right_radius(), computed.border_bottom_right_radius(),
-		computed.border_bottom_left_radius());
+	const CornerSizes radii = {computed.border_top_left_radius(), computed.border_top_right_radius(), computed.border_bottom_right_radius(),
+		computed.border_bottom_left_radius()};
 
 	for (int i = 0; i < element->GetNumBoxes(); i++)
 	{
 		Vector2f offset;
 		const Box& box = element->GetBox(i, offset);
-		GeometryUtilities::GenerateBackgroundBorder(&geometry, box, offset, radii, background_color, border_colors);
+		GeometryBackgroundBorder::Draw(vertices, indices, radii, box, offset, background_color, border_colors, &colour_sources);
 	}
 
 	geometry.Release();
@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
+#include "GeometryBackgroundBorder.h"
 
 namespace Rml {
 
@@ -42,14 +43,24 @@ public:
 
 	void DirtyBackground();
 	void DirtyBorder();
+	// Marks only the background and border colours as changed, which may be applied to the existing geometry.
+	void DirtyColours();
 
 private:
 	void GenerateGeometry(Element* element);
 
+	// Applies new colours to the existing vertices, returns false if the geometry must be generated again instead.
+	bool RecolourGeometry(Element* element);
+
 	bool background_dirty = false;
 	bool border_dirty = false;
+	bool colours_dirty = false;
 
 	Geometry geometry;
+
+	// The colours the geometry was generated with, in background-top-right-bottom-left order, and the colour source of each vertex.
+	Colourb colours[5];
+	Vector<GeometryBackgroundBorder::ColourSource> colour_sources;
 };
 
 } // namespace Rml
@@ -108,12 +108,17 @@ bool ElementDecoration::ReloadDecorators()
 // Loads a single decorator and adds it to the list of loaded decorators for this element.
 void ElementDecoration::ReloadDecoratorsData()
 {
-	if (decorators_data_dirty)
+	if (decorators_data_dirty || decorators_opacity_dirty)
 	{
+		const bool regenerate_all = decorators_data_dirty;
 		decorators_data_dirty = false;
+		decorators_opacity_dirty = false;
 
 		for (DecoratorHandle& decorator : decorators)
 		{
+			if (!regenerate_all && !decorator.decorator->IsOpacityDependent())
+				continue;
+
 			if (decorator.decorator_data)
 				decorator.decorator->ReleaseElementData(decorator.decorator_data);
 
@@ -152,6 +157,7 @@ void ElementDecoration::RenderDecorators()
 void ElementDecoration::DirtyDecorators()
 {
 	decorators_dirty = true;
+	element->DirtyUpdate();
 }
 
 void ElementDecoration::DirtyDecoratorsData()
@@ -159,4 +165,9 @@ void ElementDecoration::DirtyDecoratorsData()
 	decorators_data_dirty = true;
 }
 
+void ElementDecoration::DirtyDecoratorsOpacity()
+{
+	decorators_opacity_dirty = true;
+}
+
 } // namespace Rml
@@ -60,6 +60,8 @@ public:
 	void DirtyDecorators();
 	/// Mark the element data of decorators as dirty.
 	void DirtyDecoratorsData();
+	/// Mark the element data of decorators which depend on the element's opacity as dirty.
+	void DirtyDecoratorsOpacity();
 
 private:
 	// Releases existing decorators and loads all decorators required by the element's definition.
@@ -87,6 +89,8 @@ private:
 	bool decorators_dirty = false;
 	// If set, element data of all decorators need to be regenerated.
 	bool decorators_data_dirty = false;
+	// If set, element data of decorators which depend on opacity need to be regenerated.
+	bool decorators_opacity_dirty = false;
 };
 
 } // namespace Rml
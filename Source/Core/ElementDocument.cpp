@@ -43,6 +43,7 @@
 #include "Template.h"
 #include "TemplateCache.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -434,6 +435,75 @@ void ElementDocument::UpdateLayout()
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
+		dirty_layout_boundaries.clear();
+	}
+	else if (!dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("LayoutBoundaries");
+
+		Vector<ObserverPtr<Element>> layout_boundaries;
+		std::swap(layout_boundaries, dirty_layout_boundaries);
+
+		auto is_dirty_layout_boundary = [&layout_boundaries](Element* element) {
+			return std::any_of(layout_boundaries.begin(), layout_boundaries.end(),
+				[element](const ObserverPtr<Element>& boundary) { return boundary.get() == element; });
+		};
+
+		for (const ObserverPtr<Element>& boundary_ptr : layout_boundaries)
+		{
+			Element* boundary = boundary_ptr.get();
+
+			// Boundaries which have been removed from the document since being dirtied have already dirtied their previous parent. Otherwise, we
+			// fall back to formatting the whole document if they no longer act as layout boundaries.
+			if (!boundary || boundary->GetOwnerDocument() != this)
+				continue;
+			if (!LayoutEngine::IsLayoutBoundary(boundary))
+			{
+				layout_dirty = true;
+				UpdateLayout();
+				return;
+			}
+
+			// Skip boundaries located inside other dirty boundaries, they will be formatted as part of their ancestor.
+			bool inside_dirty_boundary = false;
+			for (Element* ancestor = boundary->GetParentNode(); ancestor && ancestor != this && !inside_dirty_boundary; ancestor = ancestor->GetParentNode())
+				inside_dirty_boundary = is_dirty_layout_boundary(ancestor);
+
+			if (!inside_dirty_boundary)
+				LayoutEngine::FormatLayoutBoundary(boundary);
+		}
+
+		// As above, ignore dirtied layout during formatting.
+		layout_dirty = false;
+		dirty_layout_boundaries.clear();
+	}
+
+	DispatchResizeEvents();
+}
+
+void ElementDocument::AddResizedElement(Element* element)
+{
+	// Elements may be resized several times during a single layout, they should only receive a single event.
+	auto it = std::find_if(resized_elements.begin(), resized_elements.end(),
+		[element](const ObserverPtr<Element>& resized_element) { return resized_element.get() == element; });
+	if (it == resized_elements.end())
+		resized_elements.push_back(element->GetObserverPtr());
+}
+
+void ElementDocument::DispatchResizeEvents()
+{
+	if (resized_elements.empty())
+		return;
+
+	// Listeners may modify the document, thus the events are dispatched after the layout is complete. Any changes to the layout are
+	// then formatted during the next update.
+	Vector<ObserverPtr<Element>> elements;
+	std::swap(elements, resized_elements);
+
+	for (const ObserverPtr<Element>& element_ptr : elements)
+	{
+		if (Element* element = element_ptr.get())
+			element->DispatchEvent(EventId::Resize, Dictionary());
 	}
 }
 
@@ -491,6 +561,19 @@ bool ElementDocument::IsLayoutDirty()
 	return layout_dirty;
 }
 
+void ElementDocument::DirtyLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element && element->GetOwnerDocument() == this);
+
+	for (const ObserverPtr<Element>& boundary : dirty_layout_boundaries)
+	{
+		if (boundary.get() == element)
+			return;
+	}
+
+	dirty_layout_boundaries.push_back(element->GetObserverPtr());
+}
+
 void ElementDocument::DirtyVwAndVhProperties()
 {
 	GetStyle()->DirtyPropertiesWithUnitsRecursive(Property::VW | Property::VH);
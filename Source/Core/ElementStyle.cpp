@@ -65,6 +65,7 @@ inline PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag_atom = MakeAtom(element->GetTagName());
 }
 
 // Returns one of this element's properties.
@@ -221,13 +222,13 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 	if (activate)
 	{
-		PseudoClassState& state = pseudo_classes[pseudo_class];
+		PseudoClassState& state = pseudo_classes[MakeAtom(pseudo_class)];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
 	}
 	else
 	{
-		auto it = pseudo_classes.find(pseudo_class);
+		auto it = pseudo_classes.find(FindAtom(pseudo_class));
 		if (it != pseudo_classes.end())
 		{
 			PseudoClassState& state = it->second;
@@ -245,6 +246,11 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 // Checks if a specific pseudo-class has been set on the element.
 bool ElementStyle::IsPseudoClassSet(const String& pseudo_class) const
+{
+	return IsPseudoClassSet(FindAtom(pseudo_class));
+}
+
+bool ElementStyle::IsPseudoClassSet(Atom pseudo_class) const
 {
 	return (pseudo_classes.count(pseudo_class) == 1);
 }
@@ -264,6 +270,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		if (class_location == classes.end())
 		{
 			classes.push_back(class_name);
+			InsertAtom(class_atoms, MakeAtom(class_name));
 			changed = true;
 		}
 	}
@@ -272,6 +279,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		if (class_location != classes.end())
 		{
 			classes.erase(class_location);
+			EraseAtom(class_atoms, FindAtom(class_name));
 			changed = true;
 		}
 	}
@@ -282,7 +290,12 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 // Checks if a class is set on the element.
 bool ElementStyle::IsClassSet(const String& class_name) const
 {
-	return std::find(classes.begin(), classes.end(), class_name) != classes.end();
+	return IsClassSet(FindAtom(class_name));
+}
+
+bool ElementStyle::IsClassSet(Atom class_name) const
+{
+	return ContainsAtom(class_atoms, class_name);
 }
 
 // Specifies the entire list of classes for this element. This will replace any others specified.
@@ -290,6 +303,10 @@ void ElementStyle::SetClassNames(const String& class_names)
 {
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
+
+	class_atoms.clear();
+	for (const String& name : classes)
+		InsertAtom(class_atoms, MakeAtom(name));
 }
 
 // Returns the list of classes specified for this element.
@@ -313,6 +330,26 @@ const StringList& ElementStyle::GetClassNameList() const
 	return classes;
 }
 
+const AtomList& ElementStyle::GetClassAtoms() const
+{
+	return class_atoms;
+}
+
+void ElementStyle::SetId(const String& id)
+{
+	id_atom = MakeAtom(id);
+}
+
+Atom ElementStyle::GetIdAtom() const
+{
+	return id_atom;
+}
+
+Atom ElementStyle::GetTagAtom() const
+{
+	return tag_atom;
+}
+
 // Sets a local property override on the element to a pre-parsed value.
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
@@ -455,6 +492,7 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyPropertiesWithUnits(Property::Unit units)
@@ -512,12 +550,14 @@ PropertiesIterator ElementStyle::Iterate() const {
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 // Sets a list of properties as dirty.
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
@@ -888,6 +928,45 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
 	}
 
+	return TakeDirtyProperties();
+}
+
+bool ElementStyle::CanShareComputedValues(const ElementStyle& other) const
+{
+	return definition && definition == other.definition && inline_properties.GetNumProperties() == 0 &&
+		other.inline_properties.GetNumProperties() == 0 && other.dirty_properties.Empty();
+}
+
+PropertyIdSet ElementStyle::ShareComputedValues(Style::ComputedValues& values, const Style::ComputedValues& other_values)
+{
+	if (dirty_properties.Empty())
+		return PropertyIdSet();
+
+	const float font_size_before = values.font_size();
+	const Style::LineHeight line_height_before = values.line_height();
+
+	values.ShareWith(other_values);
+
+	// Dirty any properties depending on the font-size or line-height, as they would have been if we computed the values ourselves.
+	if (font_size_before != values.font_size())
+	{
+		dirty_properties.Insert(PropertyId::LineHeight);
+		for (auto it = Iterate(); !it.AtEnd(); ++it)
+		{
+			auto name_property_pair = *it;
+			if (name_property_pair.second.unit == Property::EM)
+				dirty_properties.Insert(name_property_pair.first);
+		}
+	}
+
+	if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+		dirty_properties.Insert(PropertyId::VerticalAlign);
+
+	return TakeDirtyProperties();
+}
+
+PropertyIdSet ElementStyle::TakeDirtyProperties()
+{
 	// Next, pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
@@ -896,7 +975,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		for (int i = 0; i < element->GetNumChildren(true); i++)
 		{
 			auto child = element->GetChild(i);
-			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->GetStyle()->DirtyProperties(dirty_inherited_properties);
 		}
 	}
 	
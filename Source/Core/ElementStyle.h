@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "Atom.h"
 
 namespace Rml {
 
@@ -41,7 +42,7 @@ class PropertiesIterator;
 enum class RelativeTarget;
 
 enum class PseudoClassState : std::uint8_t { Clear = 0, Set = 1, Override = 2 };
-using PseudoClassMap = SmallUnorderedMap< String, PseudoClassState >;
+using PseudoClassMap = SmallUnorderedMap< Atom, PseudoClassState >;
 
 
 /**
@@ -70,6 +71,10 @@ public:
 	/// @param[in] pseudo_class The name of the pseudo-class to check for.
 	/// @return True if the pseudo-class is set on the element, false if not.
 	bool IsPseudoClassSet(const String& pseudo_class) const;
+	/// Checks if a specific pseudo-class has been set on the element.
+	/// @param[in] pseudo_class The atom of the pseudo-class to check for.
+	/// @return True if the pseudo-class is set on the element, false if not.
+	bool IsPseudoClassSet(Atom pseudo_class) const;
 	/// Gets a list of the current active pseudo classes
 	const PseudoClassMap& GetActivePseudoClasses() const;
 
@@ -82,6 +87,10 @@ public:
 	/// @param[in] class_name The name of the class to check for.
 	/// @return True if the class is set on the element, false otherwise.
 	bool IsClassSet(const String& class_name) const;
+	/// Checks if a class is set on the element.
+	/// @param[in] class_name The atom of the class to check for.
+	/// @return True if the class is set on the element, false otherwise.
+	bool IsClassSet(Atom class_name) const;
 	/// Specifies the entire list of classes for this element. This will replace any others specified.
 	/// @param[in] class_names The list of class names to set on the style, separated by spaces.
 	void SetClassNames(const String& class_names);
@@ -90,6 +99,15 @@ public:
 	String GetClassNames() const;
 	/// Return the active class list.
 	const StringList& GetClassNameList() const;
+	/// Return the active class list as atoms, sorted by their identifiers.
+	const AtomList& GetClassAtoms() const;
+
+	/// Sets the id of the element, as used for selector matching.
+	void SetId(const String& id);
+	/// Returns the atom of the element's id, or the invalid atom if it has none.
+	Atom GetIdAtom() const;
+	/// Returns the atom of the element's tag name.
+	Atom GetTagAtom() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
@@ -140,6 +158,13 @@ public:
 	/// Must be called in correct order, always parent before its children.
 	PropertyIdSet ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions);
 
+	/// Returns true if this element can share the computed values of the other element's style, assuming they have the same parent.
+	/// This is the case when both use the same definition without any inline properties, and the other values are up-to-date.
+	bool CanShareComputedValues(const ElementStyle& other) const;
+	/// Shares the computed values of another element in place of computing them, see CanShareComputedValues().
+	/// @return The dirty properties, as with ComputeValues().
+	PropertyIdSet ShareComputedValues(Style::ComputedValues& values, const Style::ComputedValues& other_values);
+
 	/// Returns an iterator for iterating the local properties of this element.
 	/// Note: Modifying the element's style invalidates its iterator.
 	PropertiesIterator Iterate() const;
@@ -152,11 +177,19 @@ private:
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static void TransitionPropertyChanges(Element * element, PropertyIdSet & properties, const PropertyDictionary & inline_properties, const ElementDefinition * old_definition, const ElementDefinition * new_definition);
 
+	// Passes any inheritable dirty properties onto our children, then returns and clears the dirty properties.
+	PropertyIdSet TakeDirtyProperties();
+
 	// Element these properties belong to
 	Element* element;
 
 	// The list of classes applicable to this object.
 	StringList classes;
+	// The same classes as atoms, used for fast selector matching.
+	AtomList class_atoms;
+	// The element's tag name and id as atoms.
+	Atom tag_atom = Atom::Invalid;
+	Atom id_atom = Atom::Invalid;
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
@@ -146,14 +146,22 @@ void ElementText::OnRender()
 		}
 	}
 	
+	const Colourb colour_multiplier(255, 255, 255, byte(opacity * 255.f));
+
 	if (render)
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
+		{
+			geometry[i].SetColourMultiplier(colour_multiplier);
 			geometry[i].Render(translation);
+		}
 	}
 
 	if (decoration)
+	{
+		decoration->SetColourMultiplier(colour_multiplier);
 		decoration->Render(translation);
+	}
 }
 
 // Generates a token of text from this element, returning only the width.
@@ -349,26 +357,17 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	bool font_face_changed = false;
 	auto& computed = GetComputedValues();
 
-	if (changed_properties.Contains(PropertyId::Color) ||
-		changed_properties.Contains(PropertyId::Opacity))
-	{
-		const float new_opacity = computed.opacity();
-		const bool opacity_changed = opacity != new_opacity;
+	Colourb previous_colour = colour;
 
-		Colourb new_colour = computed.color();
-		new_colour.alpha = byte(new_opacity * float(new_colour.alpha));
-		colour_changed = colour != new_colour;
+	// Opacity is applied as a colour multiplier when rendering, thus the geometry is left unchanged.
+	if (changed_properties.Contains(PropertyId::Opacity))
+		opacity = computed.opacity();
 
-		if (colour_changed)
-		{
-			colour = new_colour;
-		}
-		if (opacity_changed)
-		{
-			opacity = new_opacity;
-			font_effects_dirty = true;
-			geometry_dirty = true;
-		}
+	if (changed_properties.Contains(PropertyId::Color))
+	{
+		const Colourb new_colour = computed.color();
+		colour_changed = colour != new_colour;
+		colour = new_colour;
 	}
 
 	if (changed_properties.Contains(PropertyId::FontFamily) ||
@@ -406,8 +405,9 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 	else if (colour_changed)
 	{
-		// Force the geometry to be regenerated.
-		geometry_dirty = true;
+		// Re-colour the text geometry in place if possible, otherwise force it to be regenerated.
+		if (!geometry_dirty && !RecolourGeometry(previous_colour))
+			geometry_dirty = true;
 
 		// Re-colour the decoration geometry.
 		if (decoration)
@@ -480,11 +480,49 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, Line& line)
 {
-	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, opacity, geometry);
+	// Opacity is applied as a colour multiplier when rendering, instead of to the generated vertex colours.
+	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, 1.f, geometry);
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].SetHostElement(this);
 }
 
+bool ElementText::RecolourGeometry(Colourb previous_colour)
+{
+	RMLUI_ZoneScoped;
+
+	// Font effect layers are rendered in their own colours, which we can't tell apart from the text colour.
+	if (font_effects_handle != 0 || font_effects_dirty)
+		return false;
+
+	// Glyphs with their own colours are rendered with white vertex colours, which we can't tell apart from white text.
+	const Colourb previous_glyph_colour(255, 255, 255, previous_colour.alpha);
+	if (previous_colour == previous_glyph_colour)
+		return false;
+
+	// Only re-colour the vertices if all of them were generated with the previous colour.
+	for (Geometry& layer_geometry : geometry)
+	{
+		for (const Vertex& vertex : layer_geometry.GetVertices())
+		{
+			Colourb vertex_colour = vertex.colour;
+			if (vertex_colour != previous_colour && vertex_colour != previous_glyph_colour)
+				return false;
+		}
+	}
+
+	const Colourb glyph_colour(255, 255, 255, colour.alpha);
+
+	for (Geometry& layer_geometry : geometry)
+	{
+		for (Vertex& vertex : layer_geometry.GetVertices())
+			vertex.colour = (vertex.colour == previous_colour ? colour : glyph_colour);
+
+		layer_geometry.Release();
+	}
+
+	return true;
+}
+
 // Generates any geometry necessary for rendering a line decoration (underline, strike-through, etc).
 void ElementText::GenerateDecoration(const FontFaceHandle font_face_handle)
 {
@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "RenderCommandList.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -287,6 +288,12 @@ void ElementUtilities::ApplyActiveClipRegion(Context* context, RenderInterface*
 	Vector2i dimensions;
 	bool clip_enabled = context->GetActiveClipRegion(origin, dimensions);
 
+	if (RenderCommandList* render_commands = context->active_render_commands)
+	{
+		render_commands->SetScissorRegion(clip_enabled, origin, dimensions);
+		return;
+	}
+
 	render_interface->EnableScissorRegion(clip_enabled);
 	if (clip_enabled)
 	{
@@ -363,7 +370,11 @@ bool ElementUtilities::ApplyTransform(Element &element)
 		// Do a deep comparison as well to avoid submitting a new transform which is equal.
 		if(!old_transform || !new_transform || (old_transform_value != *new_transform))
 		{
-			render_interface->SetTransform(new_transform);
+			Context* context = element.GetContext();
+			if (RenderCommandList* render_commands = (context ? context->active_render_commands : nullptr))
+				render_commands->SetTransform(new_transform);
+			else
+				render_interface->SetTransform(new_transform);
 
 			if(new_transform)
 				old_transform_value = *new_transform;
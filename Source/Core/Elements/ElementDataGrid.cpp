@@ -224,6 +224,9 @@ ElementDataGridRow* ElementDataGrid::GetRow(int index) const
 
 void ElementDataGrid::OnUpdate()
 {
+	// The rows poll their data sources for changes, thus we need to be updated every frame.
+	DirtyUpdate();
+
 	if (!new_data_source.empty())
 	{
 		root->SetDataSource(new_data_source);
@@ -291,6 +291,7 @@ void WidgetDropDown::OnValueChange(const String& value)
 	parent_element->DispatchEvent(EventId::Change, parameters);
 
 	value_rml_dirty = true;
+	parent_element->DirtyUpdate();
 }
 
 void WidgetDropDown::SetSelection(Element* select_option, bool force)
@@ -326,6 +327,7 @@ void WidgetDropDown::SetSelection(Element* select_option, bool force)
 	}
 
 	value_rml_dirty = true;
+	parent_element->DirtyUpdate();
 }
 
 void WidgetDropDown::SeekSelection(bool seek_forward)
@@ -449,6 +451,7 @@ void WidgetDropDown::OnChildAdd(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->DirtyUpdate();
 }
 
 void WidgetDropDown::OnChildRemove(Element* element)
@@ -463,6 +466,7 @@ void WidgetDropDown::OnChildRemove(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->DirtyUpdate();
 }
 
 void WidgetDropDown::AttachScrollEvent()
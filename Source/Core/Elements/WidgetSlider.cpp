@@ -161,6 +161,10 @@ void WidgetSlider::Update()
 			}
 		}
 	}
+
+	// Keep updating while any of the arrow buttons are held down.
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+		parent->DirtyUpdate();
 }
 
 // Sets the position of the bar.
@@ -396,12 +400,14 @@ void WidgetSlider::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
@@ -253,6 +253,9 @@ void WidgetTextInput::OnUpdate()
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
 		}
+
+		// Keep blinking the cursor on subsequent updates.
+		parent->DirtyUpdate();
 	}
 }
 
@@ -901,6 +904,7 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		cursor_visible = true;
 		cursor_timer = CURSOR_BLINK_TIME;
 		last_update_time = GetSystemInterface()->GetElapsedTime();
+		parent->DirtyUpdate();
 
 		// Shift the cursor into view.
 		if (move_to_cursor)
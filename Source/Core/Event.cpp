@@ -36,9 +36,27 @@ Event::Event()
 {
 }
 
-Event::Event(Element* _target_element, EventId id, const String& type, const Dictionary& _parameters, bool interruptible)
-	: parameters(_parameters), target_element(_target_element), type(type), id(id), interruptible(interruptible)
+Event::Event(Element* _target_element, EventId _id, const String& _type, const Dictionary& _parameters, bool _interruptible)
 {
+	Initialize(_target_element, _id, _type, _parameters, _interruptible);
+}
+
+void Event::Initialize(Element* _target_element, EventId _id, const String& _type, const Dictionary& _parameters, bool _interruptible)
+{
+	// Assign the members rather than constructing new ones, so that reused events can keep their allocated storage.
+	parameters = _parameters;
+	target_element = _target_element;
+	current_element = nullptr;
+	type = _type;
+	id = _id;
+	interruptible = _interruptible;
+	interrupted = false;
+	interrupted_immediate = false;
+	phase = EventPhase::None;
+
+	has_mouse_position = false;
+	mouse_screen_position = Vector2f(0, 0);
+
 	const Variant* mouse_x = GetIf(parameters, "mouse_x");
 	const Variant* mouse_y = GetIf(parameters, "mouse_y");
 	if (mouse_x && mouse_y)
@@ -28,6 +28,7 @@
 
 #include "EventDispatcher.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Factory.h"
@@ -71,6 +72,11 @@ void EventDispatcher::AttachEvent(const EventId id, EventListener* listener, con
 	if (matching_entry_it == range.second)
 	{
 		listeners.emplace(range.second, entry);
+
+		const EventIdMask mask = GetEventIdMask(id);
+		listener_mask |= mask;
+		AddToSubtreeListenerMasks(mask);
+
 		listener->OnAttach(element);
 	}
 }
@@ -82,6 +88,12 @@ void EventDispatcher::DetachEvent(const EventId id, EventListener* listener, con
 	if (listenerIt != listeners.cend())
 	{
 		listeners.erase(listenerIt);
+
+		listener_mask = 0;
+		for (const EventListenerEntry& entry : listeners)
+			listener_mask |= GetEventIdMask(entry.id);
+		DirtySubtreeListenerMasks();
+
 		listener->OnDetach(element);
 	}
 }
@@ -93,6 +105,8 @@ void EventDispatcher::DetachAllEvents()
 		event.listener->OnDetach(element);
 
 	listeners.clear();
+	listener_mask = 0;
+	DirtySubtreeListenerMasks();
 
 	for (int i = 0; i < element->GetNumChildren(true); ++i)
 		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
@@ -127,12 +141,61 @@ struct CollectedListener {
 };
 
 
+/*
+	DispatchBuffers
+
+	Storage for the listeners and default action elements collected during a dispatch. The storage is retained between dispatches
+	to avoid allocations. Events may be dispatched from within event listeners, thus each level of nesting uses its own buffers.
+*/
+class DispatchBuffers {
+public:
+	DispatchBuffers()
+	{
+		Vector<Buffers>& spare_buffers = GetSpareBuffers();
+		if (!spare_buffers.empty())
+		{
+			buffers = std::move(spare_buffers.back());
+			spare_buffers.pop_back();
+		}
+	}
+	~DispatchBuffers()
+	{
+		// Clear the buffers now so that the observed elements and listeners are not kept alive.
+		buffers.listeners.clear();
+		buffers.default_action_elements.clear();
+		GetSpareBuffers().push_back(std::move(buffers));
+	}
+
+	Vector<CollectedListener>& Listeners() { return buffers.listeners; }
+	Vector<ObserverPtr<Element>>& DefaultActionElements() { return buffers.default_action_elements; }
+
+private:
+	struct Buffers {
+		Vector<CollectedListener> listeners;
+		Vector<ObserverPtr<Element>> default_action_elements;
+	};
+
+	static Vector<Buffers>& GetSpareBuffers()
+	{
+		static thread_local Vector<Buffers> spare_buffers;
+		return spare_buffers;
+	}
+
+	Buffers buffers;
+};
+
+
 bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	// Nothing to do if no element along the propagation path listens to the event, and there are no default actions.
+	if (default_action_phase == DefaultActionPhase::None && IsUnlistenedInPath(target_element, id))
+		return true;
+
+	DispatchBuffers buffers;
+	Vector<CollectedListener>& listeners = buffers.Listeners();
+	Vector<ObserverPtr<Element>>& default_action_elements = buffers.DefaultActionElements();
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
 	
@@ -219,6 +282,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 
 void EventDispatcher::CollectListeners(int dom_distance_from_target, const EventId event_id, const EventPhase event_executes_in_phases, Vector<CollectedListener>& collect_listeners)
 {
+	if (!(listener_mask & GetEventIdMask(event_id)))
+		return;
+
 	// Find all the entries with a matching id, given that listeners are sorted by id first.
 	Listeners::iterator begin, end;
 	std::tie(begin, end) = std::equal_range(listeners.begin(), listeners.end(), EventListenerEntry(event_id, nullptr, false), CompareId());
@@ -248,6 +314,91 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 }
 
 
+void EventDispatcher::OnAttachToParent()
+{
+	Element* parent = element->GetParentNode();
+	RMLUI_ASSERT(parent);
+
+	EventDispatcher* parent_dispatcher = parent->GetEventDispatcher();
+	if (subtree_listener_mask_dirty)
+		parent_dispatcher->DirtySubtreeListenerMasks();
+	if (subtree_listener_mask)
+		parent_dispatcher->AddToSubtreeListenerMasks(subtree_listener_mask);
+}
+
+void EventDispatcher::OnDetachFromParent()
+{
+	Element* parent = element->GetParentNode();
+	RMLUI_ASSERT(parent);
+
+	// The parent's mask only needs to be recomputed if our subtree contributed to it.
+	if (subtree_listener_mask || subtree_listener_mask_dirty)
+		parent->GetEventDispatcher()->DirtySubtreeListenerMasks();
+}
+
+EventDispatcher::EventIdMask EventDispatcher::GetEventIdMask(EventId id)
+{
+	constexpr int num_bits = 8 * sizeof(EventIdMask);
+	const int bit = Math::Min((int)id, num_bits - 1);
+	return EventIdMask(1) << bit;
+}
+
+EventDispatcher::EventIdMask EventDispatcher::GetSubtreeListenerMask()
+{
+	if (subtree_listener_mask_dirty)
+	{
+		subtree_listener_mask = listener_mask;
+		const int num_children = element->GetNumChildren(true);
+		for (int i = 0; i < num_children; i++)
+			subtree_listener_mask |= element->GetChild(i)->GetEventDispatcher()->GetSubtreeListenerMask();
+
+		subtree_listener_mask_dirty = false;
+	}
+
+	return subtree_listener_mask;
+}
+
+void EventDispatcher::AddToSubtreeListenerMasks(const EventIdMask mask)
+{
+	// Ancestors always contain the mask of their descendants, thus we can stop at the first ancestor already containing the mask.
+	for (Element* ancestor = element; ancestor; ancestor = ancestor->GetParentNode())
+	{
+		EventDispatcher* dispatcher = ancestor->GetEventDispatcher();
+		if ((dispatcher->subtree_listener_mask & mask) == mask)
+			break;
+		dispatcher->subtree_listener_mask |= mask;
+	}
+}
+
+void EventDispatcher::DirtySubtreeListenerMasks()
+{
+	for (Element* ancestor = element; ancestor; ancestor = ancestor->GetParentNode())
+	{
+		EventDispatcher* dispatcher = ancestor->GetEventDispatcher();
+		if (dispatcher->subtree_listener_mask_dirty)
+			break;
+		dispatcher->subtree_listener_mask_dirty = true;
+	}
+}
+
+bool EventDispatcher::HasListener(EventId id) const
+{
+	return (listener_mask & GetEventIdMask(id)) != 0;
+}
+
+bool EventDispatcher::IsUnlistenedInPath(Element* target_element, const EventId id)
+{
+	// All elements along the propagation path are contained in the subtree of the root element, which we can find quickly through
+	// the owner document when the target is located in a document.
+	Element* root = target_element;
+	if (ElementDocument* document = target_element->GetOwnerDocument())
+		root = document;
+	while (Element* parent = root->GetParentNode())
+		root = parent;
+
+	return !(root->GetEventDispatcher()->GetSubtreeListenerMask() & GetEventIdMask(id));
+}
+
 String EventDispatcher::ToString() const
 {
 	String result;
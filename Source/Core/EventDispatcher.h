@@ -90,13 +90,39 @@ public:
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const Dictionary& parameters, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase);
 
+	/// Returns true if any listeners for the given event are attached to this element.
+	bool HasListener(EventId id) const;
+
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
 	String ToString() const;
 
+	/// Updates the listened events of the new ancestors, to be called after the element is attached to a parent.
+	void OnAttachToParent();
+	/// Updates the listened events of the current ancestors, to be called before the element is detached from its parent.
+	void OnDetachFromParent();
+
 private:
+	// Bit mask of event ids, each built-in event has its own bit while all custom events share the last bit.
+	using EventIdMask = uint64_t;
+	static EventIdMask GetEventIdMask(EventId id);
+
+	// Returns the events listened to by this element or any of its descendants, updating the mask if it is dirty.
+	EventIdMask GetSubtreeListenerMask();
+	void AddToSubtreeListenerMasks(EventIdMask mask);
+	void DirtySubtreeListenerMasks();
+
+	// Returns true if no element in the propagation path of the target element listens to the given event.
+	static bool IsUnlistenedInPath(Element* target_element, EventId id);
+
 	Element* element;
 
+	// The events listened to by this element, and by this element or any of its descendants. The subtree mask is updated immediately
+	// when listeners are added, and dirtied to be recomputed when needed as listeners or elements are removed.
+	EventIdMask listener_mask = 0;
+	EventIdMask subtree_listener_mask = 0;
+	bool subtree_listener_mask_dirty = false;
+
 	// Listeners are sorted first by (id, phase) and then by the order in which the listener was inserted.
 	// All listeners added are unique.
 	typedef Vector< EventListenerEntry > Listeners;
@@ -33,6 +33,7 @@ namespace Rml {
 
 EventInstancerDefault::EventInstancerDefault()
 {
+	pooled_events.reserve(max_pooled_events);
 }
 
 EventInstancerDefault::~EventInstancerDefault()
@@ -41,13 +42,24 @@ EventInstancerDefault::~EventInstancerDefault()
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
+	if (!pooled_events.empty())
+	{
+		Event* event = pooled_events.back().release();
+		pooled_events.pop_back();
+		event->Initialize(target, id, type, parameters, interruptible);
+		return EventPtr(event);
+	}
+
 	return EventPtr(new Event(target, id, type, parameters, interruptible));
 }
 
 // Releases an event instanced by this instancer.
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	if (pooled_events.size() < max_pooled_events)
+		pooled_events.emplace_back(event);
+	else
+		delete event;
 }
 
 void EventInstancerDefault::Release()
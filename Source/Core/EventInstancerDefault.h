@@ -35,7 +35,8 @@
 namespace Rml {
 
 /**
-	Default instancer for instancing events.
+	Default instancer for instancing events. Released events are kept in a pool for reuse, so that dispatching events does not
+	allocate after the first few dispatches.
 
 	@author Lloyd Weehuizen
  */
@@ -59,6 +60,12 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	// Events may be dispatched from within other event listeners, the pool should cover a few levels of such nesting.
+	static constexpr size_t max_pooled_events = 16;
+
+	Vector<UniquePtr<Event>> pooled_events;
 };
 
 } // namespace Rml
@@ -0,0 +1,467 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontCache.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+#include "../../../Include/RmlUi/Core/Log.h"
+#include "FreeTypeInterface.h"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <tuple>
+#include <type_traits>
+
+namespace Rml {
+
+static const char cache_file_identifier[8] = {'R', 'm', 'l', 'F', 'o', 'n', 't', 'C'};
+
+// Increment whenever the file format, the face keys, or the way glyphs are rendered into layers changes.
+static constexpr uint32_t cache_format_version = 3;
+
+// Values are written in the native byte order, this mark is read back differently on platforms with another byte order.
+static constexpr uint32_t cache_byte_order_mark = 0x01020304;
+
+// The FNV-1a hash, which is stable between runs and platforms.
+static uint64_t HashData(const byte* data, size_t length, uint64_t hash = 14695981039346656037ull)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		hash ^= data[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+// Hashes the start of the data, and evenly spaced samples of the remaining data. In sfnt fonts, the start of the file contains the table
+// directory with the checksum of every table, thus it identifies the font without hashing all of the data.
+static uint64_t HashSampledData(const byte* data, size_t length)
+{
+	static constexpr size_t header_length = 8192;
+	static constexpr size_t num_samples = 64;
+	static constexpr size_t sample_length = 256;
+
+	const uint64_t length64 = length;
+	uint64_t hash = HashData(reinterpret_cast<const byte*>(&length64), sizeof(length64));
+
+	if (length <= header_length + num_samples * sample_length)
+		return HashData(data, length, hash);
+
+	hash = HashData(data, header_length, hash);
+
+	const size_t stride = (length - header_length) / num_samples;
+	for (size_t i = 0; i < num_samples; i++)
+		hash = HashData(data + header_length + i * stride, sample_length, hash);
+
+	return hash;
+}
+
+static int GetBytesPerPixel(ColorFormat color_format)
+{
+	return color_format == ColorFormat::RGBA8 ? 4 : 1;
+}
+
+namespace {
+
+class CacheWriter {
+public:
+	CacheWriter(String& data) : data(data) {}
+
+	template <typename T>
+	void Write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly.");
+		WriteBytes(&value, sizeof(T));
+	}
+	void WriteBytes(const void* bytes, size_t length) { data.append(static_cast<const char*>(bytes), length); }
+	void WriteString(const String& value)
+	{
+		Write(uint32_t(value.size()));
+		WriteBytes(value.data(), value.size());
+	}
+
+private:
+	String& data;
+};
+
+class CacheReader {
+public:
+	CacheReader(const String& data) : it(data.data()), end(data.data() + data.size()) {}
+
+	template <typename T>
+	T Read()
+	{
+		T value{};
+		ReadBytes(&value, sizeof(T));
+		return value;
+	}
+	void ReadBytes(void* bytes, size_t length)
+	{
+		if (!CanRead(length))
+		{
+			failed = true;
+			memset(bytes, 0, length);
+			return;
+		}
+		memcpy(bytes, it, length);
+		it += length;
+	}
+	String ReadString()
+	{
+		const uint32_t length = Read<uint32_t>();
+		if (!CanRead(length))
+		{
+			failed = true;
+			return String();
+		}
+		String result(it, length);
+		it += length;
+		return result;
+	}
+
+	// Returns true if the given number of bytes remain, used to validate sizes before allocating for them.
+	bool CanRead(size_t length) const { return !failed && size_t(end - it) >= length; }
+	bool Failed() const { return failed; }
+	bool AtEnd() const { return it == end; }
+
+private:
+	const char* it;
+	const char* end;
+	bool failed = false;
+};
+
+} // namespace
+
+// Returns the elements of the map sorted by key, so that the written cache does not depend on the iteration order of the map.
+template <typename MapType>
+static Vector<const typename MapType::value_type*> GetSortedElements(const MapType& map)
+{
+	Vector<const typename MapType::value_type*> result;
+	result.reserve(map.size());
+	for (const auto& pair : map)
+		result.push_back(&pair);
+	std::sort(result.begin(), result.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+	return result;
+}
+
+static void WriteEntry(CacheWriter& writer, const FontCache::Entry& entry)
+{
+	writer.Write(entry.face_key);
+	writer.Write(int32_t(entry.size));
+	writer.Write(uint8_t(entry.distance_field));
+
+	const FontMetrics& metrics = entry.metrics;
+	writer.Write(int32_t(metrics.size));
+	writer.Write(int32_t(metrics.x_height));
+	writer.Write(int32_t(metrics.line_height));
+	writer.Write(int32_t(metrics.baseline));
+	writer.Write(metrics.underline_position);
+	writer.Write(metrics.underline_thickness);
+
+	writer.Write(uint32_t(entry.glyphs.size()));
+	for (const auto* pair : GetSortedElements(entry.glyphs))
+	{
+		const FontGlyph& glyph = pair->second;
+		writer.Write(uint32_t(pair->first));
+		writer.Write(glyph.dimensions);
+		writer.Write(glyph.bearing);
+		writer.Write(int32_t(glyph.advance));
+		writer.Write(glyph.bitmap_dimensions);
+		writer.Write(uint8_t(glyph.color_format));
+		writer.Write(uint8_t(glyph.bitmap_data != nullptr));
+		if (glyph.bitmap_data)
+			writer.WriteBytes(glyph.bitmap_data, size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * GetBytesPerPixel(glyph.color_format)));
+	}
+
+	Vector<FontCache::KerningPair> kerning = entry.kerning;
+	std::sort(kerning.begin(), kerning.end(), [](const FontCache::KerningPair& a, const FontCache::KerningPair& b) {
+		return a.lhs < b.lhs || (a.lhs == b.lhs && a.rhs < b.rhs);
+	});
+
+	writer.Write(uint32_t(kerning.size()));
+	for (const FontCache::KerningPair& pair : kerning)
+	{
+		writer.Write(uint32_t(pair.lhs));
+		writer.Write(uint32_t(pair.rhs));
+		writer.Write(int32_t(pair.kerning));
+	}
+
+	writer.Write(uint32_t(entry.layers.size()));
+	for (const auto* layer : GetSortedElements(entry.layers))
+	{
+		writer.Write(layer->first);
+		writer.Write(uint32_t(layer->second.size()));
+		for (const auto* pair : GetSortedElements(layer->second))
+		{
+			writer.Write(uint32_t(pair->first));
+			writer.Write(pair->second.dimensions);
+			writer.WriteBytes(pair->second.data.data(), pair->second.data.size());
+		}
+	}
+}
+
+static bool ReadEntry(CacheReader& reader, FontCache::Entry& entry)
+{
+	entry.face_key = reader.Read<uint64_t>();
+	entry.size = reader.Read<int32_t>();
+	entry.distance_field = (reader.Read<uint8_t>() != 0);
+
+	FontMetrics& metrics = entry.metrics;
+	metrics.size = reader.Read<int32_t>();
+	metrics.x_height = reader.Read<int32_t>();
+	metrics.line_height = reader.Read<int32_t>();
+	metrics.baseline = reader.Read<int32_t>();
+	metrics.underline_position = reader.Read<float>();
+	metrics.underline_thickness = reader.Read<float>();
+
+	const uint32_t num_glyphs = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < num_glyphs && !reader.Failed(); i++)
+	{
+		const Character character = Character(reader.Read<uint32_t>());
+		FontGlyph glyph;
+		glyph.dimensions = reader.Read<Vector2i>();
+		glyph.bearing = reader.Read<Vector2i>();
+		glyph.advance = reader.Read<int32_t>();
+		glyph.bitmap_dimensions = reader.Read<Vector2i>();
+		const uint8_t color_format = reader.Read<uint8_t>();
+		const bool has_bitmap = (reader.Read<uint8_t>() != 0);
+
+		if ((color_format != uint8_t(ColorFormat::A8) && color_format != uint8_t(ColorFormat::RGBA8)) || glyph.bitmap_dimensions.x < 0 || glyph.bitmap_dimensions.y < 0)
+			return false;
+		glyph.color_format = ColorFormat(color_format);
+
+		if (has_bitmap)
+		{
+			const size_t num_bytes = size_t(glyph.bitmap_dimensions.x) * size_t(glyph.bitmap_dimensions.y) * GetBytesPerPixel(glyph.color_format);
+			if (!reader.CanRead(num_bytes))
+				return false;
+			glyph.bitmap_owned_data.reset(new byte[num_bytes]);
+			reader.ReadBytes(glyph.bitmap_owned_data.get(), num_bytes);
+			glyph.bitmap_data = glyph.bitmap_owned_data.get();
+		}
+
+		entry.glyphs[character] = std::move(glyph);
+	}
+
+	const uint32_t num_kerning_pairs = reader.Read<uint32_t>();
+	if (!reader.CanRead(size_t(num_kerning_pairs) * 12))
+		return false;
+	entry.kerning.resize(num_kerning_pairs);
+	for (FontCache::KerningPair& pair : entry.kerning)
+	{
+		pair.lhs = Character(reader.Read<uint32_t>());
+		pair.rhs = Character(reader.Read<uint32_t>());
+		pair.kerning = reader.Read<int32_t>();
+	}
+
+	const uint32_t num_layers = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < num_layers && !reader.Failed(); i++)
+	{
+		FontCache::LayerGlyphMap& layer = entry.layers[reader.Read<uint64_t>()];
+		const uint32_t num_layer_glyphs = reader.Read<uint32_t>();
+		for (uint32_t j = 0; j < num_layer_glyphs && !reader.Failed(); j++)
+		{
+			const Character character = Character(reader.Read<uint32_t>());
+			FontCache::LayerGlyph& layer_glyph = layer[character];
+			layer_glyph.dimensions = reader.Read<Vector2i>();
+			if (layer_glyph.dimensions.x < 0 || layer_glyph.dimensions.y < 0)
+				return false;
+
+			const size_t num_bytes = size_t(layer_glyph.dimensions.x) * size_t(layer_glyph.dimensions.y) * 4;
+			if (!reader.CanRead(num_bytes))
+				return false;
+			layer_glyph.data.resize(num_bytes);
+			reader.ReadBytes(layer_glyph.data.data(), num_bytes);
+		}
+	}
+
+	return !reader.Failed();
+}
+
+uint64_t FontCache::GetFaceKey(FontFaceHandleFreetype face)
+{
+	const byte* data = nullptr;
+	size_t data_length = 0;
+	long face_index = 0;
+	if (!FreeType::GetFaceData(face, data, data_length, face_index))
+		return 0;
+
+	const int64_t index = face_index;
+	uint64_t hash = HashSampledData(data, data_length);
+	hash = HashData(reinterpret_cast<const byte*>(&index), sizeof(index), hash);
+	return hash;
+}
+
+bool FontCache::Load(const String& file_path)
+{
+	entries.clear();
+
+	String data;
+	if (!GetFileInterface()->LoadFile(file_path, data))
+	{
+		Log::Message(Log::LT_WARNING, "Could not open font cache file '%s'.", file_path.c_str());
+		return false;
+	}
+
+	CacheReader reader(data);
+
+	char identifier[sizeof(cache_file_identifier)] = {};
+	reader.ReadBytes(identifier, sizeof(identifier));
+	const uint32_t byte_order_mark = reader.Read<uint32_t>();
+	const uint32_t format_version = reader.Read<uint32_t>();
+	const String library_version = reader.ReadString();
+
+	if (reader.Failed() || memcmp(identifier, cache_file_identifier, sizeof(identifier)) != 0)
+	{
+		Log::Message(Log::LT_WARNING, "Could not load font cache '%s': Not a font cache file.", file_path.c_str());
+		return false;
+	}
+
+	if (byte_order_mark != cache_byte_order_mark)
+	{
+		Log::Message(Log::LT_INFO, "Ignoring font cache '%s': Written on a platform with a different byte order.", file_path.c_str());
+		return false;
+	}
+
+	if (format_version != cache_format_version || library_version != GetVersion())
+	{
+		Log::Message(Log::LT_INFO, "Ignoring font cache '%s': Written by a different version of RmlUi.", file_path.c_str());
+		return false;
+	}
+
+	const uint32_t num_entries = reader.Read<uint32_t>();
+	EntryList new_entries;
+	for (uint32_t i = 0; i < num_entries; i++)
+	{
+		new_entries.emplace_back();
+		if (!ReadEntry(reader, new_entries.back()))
+		{
+			Log::Message(Log::LT_WARNING, "Could not load font cache '%s': The file is corrupt.", file_path.c_str());
+			return false;
+		}
+	}
+
+	entries = std::move(new_entries);
+	return true;
+}
+
+bool FontCache::Save(const String& file_path, const EntryList& new_entries) const
+{
+	auto IsSuperseded = [&new_entries](const Entry& entry) {
+		return std::any_of(new_entries.begin(), new_entries.end(), [&entry](const Entry& new_entry) {
+			return new_entry.face_key == entry.face_key && new_entry.size == entry.size && new_entry.distance_field == entry.distance_field;
+		});
+	};
+
+	String data;
+	CacheWriter writer(data);
+
+	writer.WriteBytes(cache_file_identifier, sizeof(cache_file_identifier));
+	writer.Write(cache_byte_order_mark);
+	writer.Write(cache_format_version);
+	writer.WriteString(GetVersion());
+
+	Vector<const Entry*> write_entries;
+	for (const Entry& entry : new_entries)
+		write_entries.push_back(&entry);
+	for (const Entry& entry : entries)
+	{
+		if (!IsSuperseded(entry))
+			write_entries.push_back(&entry);
+	}
+
+	std::sort(write_entries.begin(), write_entries.end(), [](const Entry* a, const Entry* b) {
+		return std::tie(a->face_key, a->size, a->distance_field) < std::tie(b->face_key, b->size, b->distance_field);
+	});
+
+	writer.Write(uint32_t(write_entries.size()));
+	for (const Entry* entry : write_entries)
+		WriteEntry(writer, *entry);
+
+	FILE* file = fopen(file_path.c_str(), "wb");
+	if (!file)
+	{
+		Log::Message(Log::LT_WARNING, "Could not open font cache file '%s' for writing.", file_path.c_str());
+		return false;
+	}
+
+	const bool result = (fwrite(data.data(), 1, data.size(), file) == data.size());
+	fclose(file);
+
+	if (!result)
+		Log::Message(Log::LT_WARNING, "Could not write font cache file '%s'.", file_path.c_str());
+
+	return result;
+}
+
+bool FontCache::IsEmpty() const
+{
+	return entries.empty();
+}
+
+bool FontCache::Find(uint64_t face_key, int size, bool distance_field, Entry& out_entry) const
+{
+	auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) {
+		return entry.face_key == face_key && entry.size == size && entry.distance_field == distance_field;
+	});
+	if (it == entries.end())
+		return false;
+
+	const Entry& entry = *it;
+	out_entry.face_key = entry.face_key;
+	out_entry.size = entry.size;
+	out_entry.distance_field = entry.distance_field;
+	out_entry.metrics = entry.metrics;
+	out_entry.kerning = entry.kerning;
+	out_entry.layers = entry.layers;
+
+	// The glyph bitmaps are owned by our entry, give the copy its own bitmaps.
+	out_entry.glyphs.clear();
+	out_entry.glyphs.reserve(entry.glyphs.size());
+	for (const auto& pair : entry.glyphs)
+	{
+		const FontGlyph& glyph = pair.second;
+		FontGlyph& glyph_copy = out_entry.glyphs[pair.first] = glyph.WeakCopy();
+		if (glyph.bitmap_data)
+		{
+			const size_t num_bytes = size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * GetBytesPerPixel(glyph.color_format));
+			glyph_copy.bitmap_owned_data.reset(new byte[num_bytes]);
+			memcpy(glyph_copy.bitmap_owned_data.get(), glyph.bitmap_data, num_bytes);
+			glyph_copy.bitmap_data = glyph_copy.bitmap_owned_data.get();
+		}
+	}
+
+	return true;
+}
+
+void FontCache::Clear()
+{
+	entries.clear();
+}
+
+} // namespace Rml
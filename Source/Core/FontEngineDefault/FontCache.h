@@ -0,0 +1,98 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTCACHE_H
+
+#include "FontTypes.h"
+
+namespace Rml {
+
+/**
+	Stores the rasterized glyphs, metrics, kerning and rendered layer glyphs of font face handles, so that they can be written to
+	a file and restored on later runs instead of being generated again.
+
+	Entries are identified by the font data of their face, their font size, and whether they generate distance fields. Layers
+	within an entry are identified by the fingerprint of their font effect, or zero for the base layer.
+ */
+
+class FontCache
+{
+public:
+	// The image of a single glyph as rendered into a layer texture, in RGBA format.
+	struct LayerGlyph {
+		Vector2i dimensions;
+		Vector<byte> data;
+	};
+	using LayerGlyphMap = UnorderedMap<Character, LayerGlyph>;
+	using LayerMap = UnorderedMap<uint64_t, LayerGlyphMap>;
+
+	struct KerningPair {
+		Character lhs, rhs;
+		int kerning;
+	};
+
+	struct Entry {
+		uint64_t face_key = 0;
+		int size = 0;
+		bool distance_field = false;
+
+		FontMetrics metrics = {};
+		FontGlyphMap glyphs;
+		Vector<KerningPair> kerning;
+		LayerMap layers;
+	};
+	using EntryList = Vector<Entry>;
+
+	/// Returns the key identifying the given face in the cache, derived from samples of its font data.
+	static uint64_t GetFaceKey(FontFaceHandleFreetype face);
+
+	/// Loads the entries of a cache file through the file interface, replacing any existing entries.
+	/// @return False if the file could not be read, or if it was written by an incompatible version.
+	bool Load(const String& file_path);
+
+	/// Writes the given entries to a file, followed by our own entries that are not superseded by any of them.
+	bool Save(const String& file_path, const EntryList& entries) const;
+
+	/// Returns true if there are no entries.
+	bool IsEmpty() const;
+
+	/// Copies an entry from the cache. The entry is kept, so that it can be restored again, such as after the font resources have
+	/// been released, and so that it is written to later saved files.
+	/// @return True if a matching entry was found.
+	bool Find(uint64_t face_key, int size, bool distance_field, Entry& out_entry) const;
+
+	/// Removes all entries.
+	void Clear();
+
+private:
+	EntryList entries;
+};
+
+} // namespace Rml
+#endif
@@ -29,10 +29,14 @@
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFace.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
 
+// The size at which glyphs are rasterized to generate their distance fields.
+static constexpr int distance_field_font_size = 48;
+
 FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight)
 {
 	style = _style;
@@ -71,9 +75,11 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 		return nullptr;
 	}
 
+	FontFaceHandleDefault* distance_field_source = (FontProvider::IsDistanceFieldRenderingEnabled() ? GetDistanceFieldHandle() : nullptr);
+
 	// Construct and initialise the new handle.
-	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	auto handle = CreateHandle(size, load_default_glyphs, distance_field_source, false);
+	if (!handle)
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -89,7 +95,63 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 
 void FontFace::ReleaseFontResources()
 {
+	// The handles may refer to the distance field handle, release them first.
 	HandleMap().swap(handles);
+	distance_field_handle.reset();
+	distance_field_handle_failed = false;
+}
+
+FontFaceHandleDefault* FontFace::GetDistanceFieldHandle()
+{
+	if (!distance_field_handle && !distance_field_handle_failed)
+	{
+		distance_field_handle = CreateHandle(distance_field_font_size, true, nullptr, true);
+		distance_field_handle_failed = !distance_field_handle;
+	}
+
+	return distance_field_handle.get();
+}
+
+UniquePtr<FontFaceHandleDefault> FontFace::CreateHandle(int size, bool load_default_glyphs, FontFaceHandleDefault* distance_field_source,
+	bool generate_distance_field)
+{
+	FontCache::Entry cache_entry;
+	FontCache& font_cache = FontProvider::GetFontCache();
+	const bool cached = (!font_cache.IsEmpty() && font_cache.Find(GetCacheKey(), size, generate_distance_field, cache_entry));
+
+	auto handle = MakeUnique<FontFaceHandleDefault>();
+	if (!handle->Initialize(face, size, load_default_glyphs, distance_field_source, generate_distance_field, cached ? &cache_entry : nullptr))
+		return nullptr;
+
+	return handle;
+}
+
+uint64_t FontFace::GetCacheKey()
+{
+	if (!cache_key && face)
+		cache_key = FontCache::GetFaceKey(face);
+	return cache_key;
+}
+
+void FontFace::GetCacheEntries(FontCache::EntryList& entries)
+{
+	auto AddEntry = [this, &entries](FontFaceHandleDefault* handle, bool distance_field) {
+		entries.emplace_back();
+		FontCache::Entry& entry = entries.back();
+		entry.face_key = GetCacheKey();
+		entry.size = handle->GetSize();
+		entry.distance_field = distance_field;
+		handle->GetCacheEntry(entry);
+	};
+
+	for (auto& pair : handles)
+	{
+		if (pair.second)
+			AddEntry(pair.second.get(), false);
+	}
+
+	if (distance_field_handle)
+		AddEntry(distance_field_handle.get(), true);
 }
 
 } // namespace Rml
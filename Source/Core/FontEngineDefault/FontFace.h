@@ -30,6 +30,7 @@
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACE_H
 
 #include "../../../Include/RmlUi/Core/StyleTypes.h"
+#include "FontCache.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -58,7 +59,20 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
+	/// Adds a font cache entry for each of our handles.
+	void GetCacheEntries(FontCache::EntryList& entries);
+
 private:
+	// Returns the handle generating distance fields of the glyphs for all our sizes, creating it if needed.
+	FontFaceHandleDefault* GetDistanceFieldHandle();
+
+	// Initializes a new handle, restoring it from the font cache if possible.
+	UniquePtr<FontFaceHandleDefault> CreateHandle(int size, bool load_default_glyphs, FontFaceHandleDefault* distance_field_source,
+		bool generate_distance_field);
+
+	// Returns the key identifying this face in the font cache.
+	uint64_t GetCacheKey();
+
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
@@ -66,6 +80,11 @@ private:
 	using HandleMap = UnorderedMap< int, UniquePtr<FontFaceHandleDefault> >;
 	HandleMap handles;
 
+	UniquePtr<FontFaceHandleDefault> distance_field_handle;
+	bool distance_field_handle_failed = false;
+
+	uint64_t cache_key = 0;
+
 	FontFaceHandleFreetype face;
 };
 
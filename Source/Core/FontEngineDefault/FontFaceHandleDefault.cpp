@@ -33,12 +33,10 @@
 #include "FontFaceLayer.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
+#include <string.h>
 
 namespace Rml {
 
-static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
-static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
-
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
 	base_layer = nullptr;
@@ -52,17 +50,47 @@ FontFaceHandleDefault::~FontFaceHandleDefault()
 	layers.clear();
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs,
+	FontFaceHandleDefault* _distance_field_source, bool _generate_distance_field, FontCache::Entry* cache_entry)
 {
 	ft_face = face;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	// When rendering from distance fields, our base layer is generated from the glyphs of the source. Then, only the glyph metrics are
+	// loaded until a font effect or colour glyph requires the bitmaps. Colour faces can't be rendered from distance fields in any case.
+	glyph_bitmaps_loaded = (cache_entry || !_distance_field_source || FreeType::HasColourGlyphs(face));
+
+	if (cache_entry)
+	{
+		metrics = cache_entry->metrics;
+		glyphs = std::move(cache_entry->glyphs);
+		cached_layers = std::move(cache_entry->layers);
+	}
+	else if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs, glyph_bitmaps_loaded))
+	{
 		return false;
+	}
+
+	generate_distance_field = _generate_distance_field;
+	if (_distance_field_source && !HasColourGlyphs())
+	{
+		distance_field_source = _distance_field_source;
+
+		for (auto& pair : glyphs)
+		{
+			Character character = pair.first;
+			distance_field_source->GetOrAppendGlyph(character);
+		}
+		distance_field_source->UpdateLayersOnDirty();
+	}
 
 	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+	if (cache_entry && has_kerning)
+	{
+		for (const FontCache::KerningPair& pair : cache_entry->kerning)
+			kerning_cache.Insert(pair.lhs, pair.rhs, pair.kerning);
+	}
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
@@ -71,6 +99,50 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	return true;
 }
 
+void FontFaceHandleDefault::GetCacheEntry(FontCache::Entry& entry)
+{
+	// Entries may be restored without distance field rendering, thus they need the glyph bitmaps.
+	LoadGlyphBitmaps();
+
+	entry.metrics = metrics;
+
+	for (const auto& pair : glyphs)
+	{
+		// Glyphs from fallback fonts are looked up again when restored, as the fallback fonts may differ between runs.
+		if (fallback_characters.find(pair.first) != fallback_characters.end())
+			continue;
+
+		// Take a copy of the bitmap, it stays owned by our glyph.
+		const FontGlyph& glyph = pair.second;
+		FontGlyph& glyph_copy = entry.glyphs[pair.first] = glyph.WeakCopy();
+		if (glyph.bitmap_data)
+		{
+			const size_t num_bytes = size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+			glyph_copy.bitmap_owned_data.reset(new byte[num_bytes]);
+			memcpy(glyph_copy.bitmap_owned_data.get(), glyph.bitmap_data, num_bytes);
+			glyph_copy.bitmap_data = glyph_copy.bitmap_owned_data.get();
+		}
+	}
+
+	entry.kerning.reserve(kerning_cache.GetNumPairs());
+	kerning_cache.ForEachPair([&entry](Character lhs, Character rhs, int kerning) { entry.kerning.push_back(FontCache::KerningPair{lhs, rhs, kerning}); });
+
+	// Layers restored from the cache but not yet used are passed on as they are.
+	entry.layers = cached_layers;
+
+	for (auto& pair : layers)
+	{
+		FontFaceLayer* layer = pair.layer.get();
+		if (const uint64_t key = GetLayerCacheKey(layer))
+		{
+			FontCache::LayerGlyphMap& layer_glyphs = entry.layers[key];
+			layer->GetCachedGlyphs(glyphs, layer_glyphs);
+			for (Character character : fallback_characters)
+				layer_glyphs.erase(character);
+		}
+	}
+}
+
 // Returns the point size of this font face.
 int FontFaceHandleDefault::GetSize() const
 {
@@ -110,25 +182,15 @@ float FontFaceHandleDefault::GetUnderline(float& thickness) const
 // Returns the width a string will take up if rendered with this handle.
 int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_character)
 {
-	int width = 0;
-	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
-	{
-		Character character = *it_string;
-
-		const FontGlyph* glyph = GetOrAppendGlyph(character);
-		if (!glyph)
-			continue;
+	const FontShapedRun* run = GetShapedRun(string);
+	if (!run)
+		return ShapeString(string, prior_character, [](Character, int, bool) {});
 
-		// Adjust the cursor for the kerning between this character and the previous one.
-		width += GetKerning(prior_character, character);
-
-		// Adjust the cursor for this character's advance.
-		width += glyph->advance;
-
-		prior_character = character;
-	}
+	if (run->glyphs.empty())
+		return 0;
 
-	return width;
+	// Runs are shaped without a prior character, add its kerning with our first glyph here.
+	return run->width + GetKerning(prior_character, run->glyphs.front().character);
 }
 
 // Generates, if required, the layer configuration for a given array of font effects.
@@ -220,11 +282,15 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	const float opacity, const int layer_configuration_index)
 {
 	int geometry_index = 0;
-	int line_width = 0;
 
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int) layer_configurations.size());
 
+	// Shaping appends any missing glyphs first, so that they are added to the layers before we generate the geometry. Strings too long
+	// to be cached are shaped again while generating the geometry of each layer, instead of storing their run.
+	const FontShapedRun* run = GetShapedRun(string);
+	const int width = (run ? run->width : ShapeString(string, Character::Null, [](Character, int, bool) {}));
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
@@ -264,31 +330,25 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
 			geometry[geometry_index + tex_index].SetTexture(layer->GetTexture(tex_index));
 
-		line_width = 0;
-		Character prior_character = Character::Null;
-
-		geometry[geometry_index].GetIndices().reserve(string.size() * 6);
-		geometry[geometry_index].GetVertices().reserve(string.size() * 4);
-
-		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
-		{
-			Character character = *it_string;
-
-			const FontGlyph* glyph = GetOrAppendGlyph(character);
-			if (!glyph)
-				continue;
-
-			// Adjust the cursor for the kerning between this character and the previous one.
-			line_width += GetKerning(prior_character, character);
+		const size_t num_glyphs = (run ? run->glyphs.size() : string.size());
+		geometry[geometry_index].GetIndices().reserve(num_glyphs * 6);
+		geometry[geometry_index].GetVertices().reserve(num_glyphs * 4);
 
+		auto GenerateGlyph = [&](Character character, int offset, bool colour_glyph) {
 			// Use white vertex colors on RGB glyphs.
-			const Colourb glyph_color =
-				(layer == base_layer && glyph->color_format == ColorFormat::RGBA8 ? Colourb(255, layer_colour.alpha) : layer_colour);
+			const Colourb glyph_color = (layer == base_layer && colour_glyph ? Colourb(255, layer_colour.alpha) : layer_colour);
 
-			layer->GenerateGeometry(&geometry[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
+			layer->GenerateGeometry(&geometry[geometry_index], character, Vector2f(position.x + offset, position.y), glyph_color);
+		};
 
-			line_width += glyph->advance;
-			prior_character = character;
+		if (run)
+		{
+			for (const FontShapedRun::Glyph& glyph : run->glyphs)
+				GenerateGlyph(glyph.character, glyph.offset, glyph.colour_glyph);
+		}
+		else
+		{
+			ShapeString(string, Character::Null, GenerateGlyph);
 		}
 
 		geometry_index += num_textures;
@@ -297,18 +357,85 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	// Cull any excess geometry from a previous generation.
 	geometry.resize(geometry_index);
 
-	return line_width;
+	return width;
+}
+
+const FontShapedRun* FontFaceHandleDefault::GetShapedRun(const String& string)
+{
+	if (!FontShapedRunCache::IsCacheable(string.size()))
+		return nullptr;
+
+	if (const FontShapedRun* run = shaped_run_cache.Find(string))
+		return run;
+
+	uncached_run.glyphs.clear();
+	bool all_glyphs_found = true;
+
+	uncached_run.width = ShapeString(
+		string, Character::Null,
+		[this](Character character, int offset, bool colour_glyph) {
+			uncached_run.glyphs.push_back(FontShapedRun::Glyph{character, offset, colour_glyph});
+		},
+		&all_glyphs_found);
+
+	// Runs containing characters without a glyph are not cached, as later loaded fallback fonts may provide them.
+	if (all_glyphs_found)
+		return shaped_run_cache.Insert(string, FontShapedRun(uncached_run));
+
+	return &uncached_run;
+}
+
+template <typename Func>
+int FontFaceHandleDefault::ShapeString(const String& string, Character prior_character, Func&& func, bool* out_all_glyphs_found)
+{
+	int width = 0;
+
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		Character character = *it_string;
+		const Character string_character = character;
+
+		const FontGlyph* glyph = GetOrAppendGlyph(character);
+		if (out_all_glyphs_found && (!glyph || character != string_character))
+			*out_all_glyphs_found = false;
+		if (!glyph)
+			continue;
+
+		// Adjust the cursor for the kerning between this character and the previous one.
+		width += GetKerning(prior_character, character);
+
+		func(character, width, glyph->color_format == ColorFormat::RGBA8);
+
+		// Adjust the cursor for this character's advance.
+		width += glyph->advance;
+
+		prior_character = character;
+	}
+
+	return width;
 }
 
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
+	// If we are dirty, add the new glyphs to all the layers. Existing glyphs keep their place in the layer textures, thus
+	// geometry generated from a previous version remains valid and the version is left unchanged.
 	if(is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
+
+		if (distance_field_source)
+		{
+			if (HasColourGlyphs())
+			{
+				DisableDistanceField();
+				return true;
+			}
+
+			// Our base layer copies the new glyphs from the source layer, make sure it has them first.
+			distance_field_source->UpdateLayersOnDirty();
+		}
 
 		// Regenerate all the layers.
 		// Note: The layer regeneration needs to happen in the order in which the layers were created,
@@ -324,33 +451,87 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 	return result;
 }
 
+size_t FontFaceHandleDefault::GetKerningCacheMemoryUsage() const
+{
+	return kerning_cache.GetMemoryUsage();
+}
+
 int FontFaceHandleDefault::GetVersion() const 
 {
 	return version;
 }
 
+void FontFaceHandleDefault::AppendDistanceFieldGlyph(Character character)
+{
+	if (distance_field_source)
+		distance_field_source->GetOrAppendGlyph(character);
+}
+
+bool FontFaceHandleDefault::HasColourGlyphs() const
+{
+	return std::any_of(glyphs.begin(), glyphs.end(), [](const auto& pair) { return pair.second.color_format != ColorFormat::A8; });
+}
+
+void FontFaceHandleDefault::DisableDistanceField()
+{
+	distance_field_source = nullptr;
+
+	// Previously generated geometry refers to the distance field textures, thus it is invalidated.
+	version += 1;
+
+	for (auto& pair : layers)
+		pair.layer->Clear();
+	for (auto& pair : layers)
+		GenerateLayer(pair.layer.get());
+}
+
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
-	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
+	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs, glyph_bitmaps_loaded);
 	return result;
 }
 
-void FontFaceHandleDefault::FillKerningPairCache()
+void FontFaceHandleDefault::LoadGlyphBitmaps()
 {
-	if (!has_kerning)
+	if (glyph_bitmaps_loaded)
 		return;
 
-	for (char32_t i = KerningCache_AsciiSubsetBegin; i <= KerningCache_AsciiSubsetLast; i++)
+	glyph_bitmaps_loaded = true;
+
+	Vector<Character> characters;
+	characters.reserve(glyphs.size());
+	for (const auto& pair : glyphs)
 	{
-		for (char32_t j = KerningCache_AsciiSubsetBegin; j <= KerningCache_AsciiSubsetLast; j++)
+		if (!pair.second.bitmap_data)
+			characters.push_back(pair.first);
+	}
+
+	for (Character character : characters)
+	{
+		if (fallback_characters.find(character) == fallback_characters.end())
 		{
-			const bool first_iteration = (i == KerningCache_AsciiSubsetBegin && j == KerningCache_AsciiSubsetBegin);
+			// Glyphs which fail to load again keep their metrics, they are then rendered empty.
+			FontGlyph glyph = std::move(glyphs[character]);
+			glyphs.erase(character);
+			if (!AppendGlyph(character))
+				glyphs[character] = std::move(glyph);
+			continue;
+		}
 
-			// Fetch the kerning from the font face. Submit zero font size on subsequent iterations for performance reasons.
-			const int kerning = FreeType::GetKerning(ft_face, first_iteration ? metrics.size : 0, Character(i), Character(j));
-			if (kerning != 0)
+		// Borrowed glyphs refer to the bitmaps of the fallback font, make sure it has loaded them.
+		const int num_fallback_faces = FontProvider::CountFallbackFontFaces();
+		for (int i = 0; i < num_fallback_faces; i++)
+		{
+			FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
+			if (!fallback_face || fallback_face == this)
+				continue;
+
+			fallback_face->LoadGlyphBitmaps();
+			auto it = fallback_face->glyphs.find(character);
+			if (it != fallback_face->glyphs.end())
 			{
-				kerning_pair_cache.emplace(AsciiPair((i << 8) | j), KerningIntType(kerning));
+				glyphs[character] = it->second.WeakCopy();
+				break;
 			}
 		}
 	}
@@ -365,24 +546,14 @@ int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
 		return 0;
 
 	// See if the kerning pair has been cached.
-	const bool lhs_in_cache = (char32_t(lhs) >= KerningCache_AsciiSubsetBegin && char32_t(lhs) <= KerningCache_AsciiSubsetLast);
-	const bool rhs_in_cache = (char32_t(rhs) >= KerningCache_AsciiSubsetBegin && char32_t(rhs) <= KerningCache_AsciiSubsetLast);
-
-	if (lhs_in_cache && rhs_in_cache)
-	{
-		const auto it = kerning_pair_cache.find(AsciiPair((int(lhs) << 8) | int(rhs)));
-
-		if (it != kerning_pair_cache.end())
-		{
-			return it->second;
-		}
-
-		return 0;
-	}
-
-	// Fetch it from the font face instead.
-	const int result = FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
-	return result;
+	int kerning = 0;
+	if (kerning_cache.Find(lhs, rhs, kerning))
+		return kerning;
+
+	// Fetch it from the font face instead, and remember it for the next time.
+	kerning = FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
+	kerning_cache.Insert(lhs, rhs, kerning);
+	return kerning;
 }
 
 const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
@@ -406,6 +577,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			}
 
 			is_layers_dirty = true;
+			AppendDistanceFieldGlyph(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -416,14 +588,21 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				if (!fallback_face || fallback_face == this)
 					continue;
 
+				if (glyph_bitmaps_loaded)
+					fallback_face->LoadGlyphBitmaps();
+
 				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
 				if (glyph)
 				{
 					// Insert the new glyph into our own set of glyphs
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
-					if(pair.second)
+					if (pair.second)
+					{
+						fallback_characters.insert(character);
 						is_layers_dirty = true;
+						AppendDistanceFieldGlyph(character);
+					}
 					break;
 				}
 			}
@@ -447,6 +626,26 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	return glyph;
 }
 
+uint64_t FontFaceHandleDefault::GetLayerCacheKey(const FontFaceLayer* layer) const
+{
+	const FontEffect* font_effect = layer->GetFontEffect();
+
+	// The base layer only copies the glyph bitmaps unless it generates distance fields, no need to cache it.
+	if (!font_effect)
+		return generate_distance_field ? 1 : 0;
+
+	// Layers sharing the textures of another layer have nothing to cache. Effects without a fingerprint can't be identified between runs.
+	if (!font_effect->HasUniqueTexture())
+		return 0;
+
+	const size_t fingerprint = font_effect->GetFingerprint();
+	auto it = layer_cache.find(fingerprint);
+	if (fingerprint == 0 || it == layer_cache.end() || it->second != layer)
+		return 0;
+
+	return uint64_t(fingerprint);
+}
+
 // Generates (or shares) a layer derived from a font effect.
 FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect)
 {
@@ -461,7 +660,20 @@ FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const Fon
 	layers.push_back(EffectLayerPair{ font_effect_ptr, nullptr });
 	auto& layer = layers.back().layer;
 	
-	layer = MakeUnique<FontFaceLayer>(font_effect);
+	layer = MakeUnique<FontFaceLayer>(font_effect, generate_distance_field);
+
+	// Restore any previously rendered glyphs of the layer from the font cache.
+	if (!cached_layers.empty())
+	{
+		const uint64_t cache_key = (font_effect ? uint64_t(font_effect->GetFingerprint()) : 1);
+		auto it_cached = cached_layers.find(cache_key);
+		if (it_cached != cached_layers.end())
+		{
+			layer->SetCachedGlyphs(std::move(it_cached->second));
+			cached_layers.erase(it_cached);
+		}
+	}
+
 	GenerateLayer(layer.get());
 
 	return layer.get();
@@ -473,9 +685,22 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	const FontEffect* font_effect = layer->GetFontEffect();
 	bool result = false;
 
+	// Layers rendering from our own glyphs need their bitmaps, while the other layers scale or clone the textures of another layer.
+	if (font_effect ? font_effect->HasUniqueTexture() : !distance_field_source)
+		LoadGlyphBitmaps();
+
 	if (!font_effect)
 	{
-		result = layer->Generate(this);
+		if (distance_field_source)
+		{
+			// Render the base layer by scaling the glyphs of the source, sharing its textures.
+			const float scale = float(metrics.size) / float(distance_field_source->GetSize());
+			result = layer->Generate(this, distance_field_source->base_layer, true, scale);
+		}
+		else
+		{
+			result = layer->Generate(this);
+		}
 	}
 	else
 	{
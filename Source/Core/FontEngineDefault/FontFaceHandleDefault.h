@@ -34,6 +34,9 @@
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
+#include "FontCache.h"
+#include "FontKerningCache.h"
+#include "FontShapedRunCache.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -51,7 +54,18 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// Initializes the handle with the glyphs and metrics of the face at the given size.
+	/// @param[in] face The FreeType face to use.
+	/// @param[in] font_size The size of the handle.
+	/// @param[in] load_default_glyphs True to load the default set of glyphs (ASCII range).
+	/// @param[in] distance_field_source If set, the glyphs are rendered by scaling the distance fields of this handle, instead of from textures of our own.
+	/// @param[in] generate_distance_field True to generate distance field textures of the glyphs, for other handles to render from.
+	/// @param[in] cache_entry If set, the glyphs, metrics, kerning and rendered layer glyphs are taken from this entry instead of being generated.
+	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFaceHandleDefault* distance_field_source = nullptr,
+		bool generate_distance_field = false, FontCache::Entry* cache_entry = nullptr);
+
+	/// Fills the cache entry with our glyphs, metrics, kerning and rendered layer glyphs, so that we can be restored from it later.
+	void GetCacheEntry(FontCache::Entry& entry);
 
 	/// Returns the point size of this font face.
 	int GetSize() const;
@@ -97,17 +111,20 @@ public:
 	/// @return The width, in pixels, of the string geometry.
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, float opacity, int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	/// Returns the memory used to cache the kerning of character pairs, in bytes.
+	size_t GetKerningCacheMemoryUsage() const;
+
+	/// Version is changed whenever previously generated string geometry becomes invalid. Adding glyphs to the layers does not
+	/// change the version, since existing glyphs keep their texture coordinates.
 	int GetVersion() const;
 
 private:
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
+	// Renders the bitmaps of all glyphs, if they were loaded with only their metrics.
+	void LoadGlyphBitmaps();
 
-	// Build a kerning cache for common characters.
-	void FillKerningPairCache();
-
-	// Return the kerning for a character pair.
+	// Return the kerning for a character pair, fetching it from the font face if it is not already cached.
 	int GetKerning(Character lhs, Character rhs) const;
 
 	/// Retrieve a glyph from the given code point, building and appending a new glyph if not already built.
@@ -116,9 +133,35 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
+	/// Retrieve the glyphs of a string positioned with kerning, shaping and caching the run if not already cached.
+	/// @param[in] string  The string to shape.
+	/// @return The shaped run valid until the next call, or nullptr if the string is too long to be cached.
+	const FontShapedRun* GetShapedRun(const String& string);
+
+	/// Positions the glyphs of a string with kerning, appending any missing glyphs, and calls the function for each glyph.
+	/// @param[in] string  The string to shape.
+	/// @param[in] prior_character  The character preceding the string, the first glyph is kerned against it.
+	/// @param[in] func  Called with the character, horizontal offset, and whether the glyph has its own colours, for each glyph.
+	/// @param[out] out_all_glyphs_found  Optionally set to false if any characters were rendered without their own glyph.
+	/// @return The width of the string.
+	template <typename Func>
+	int ShapeString(const String& string, Character prior_character, Func&& func, bool* out_all_glyphs_found = nullptr);
+
 	// Regenerate layers if dirty, such as after adding new glyphs.
 	bool UpdateLayersOnDirty();
 
+	// Adds a newly appended glyph to the distance field source, if any.
+	void AppendDistanceFieldGlyph(Character character);
+
+	// Returns true if any of our glyphs can not be rendered from distance fields.
+	bool HasColourGlyphs() const;
+
+	// Stop rendering from distance fields, and generate all the layers again from our own glyphs.
+	void DisableDistanceField();
+
+	// Returns the key of the layer in font cache entries, or zero if the layer should not be cached.
+	uint64_t GetLayerCacheKey(const FontFaceLayer* layer) const;
+
 	// Create a new layer from the given font effect if it does not already exist.
 	FontFaceLayer* GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect);
 
@@ -126,6 +169,8 @@ private:
 	bool GenerateLayer(FontFaceLayer* layer);
 
 	FontGlyphMap glyphs;
+	// The characters of glyphs borrowed from fallback fonts, these are not written to the font cache.
+	UnorderedSet<Character> fallback_characters;
 
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
@@ -142,16 +187,27 @@ private:
 	// Each font layer that generated geometry or textures, indexed by the font-effect's fingerprint key.
 	FontLayerCache layer_cache;
 
-	// Pre-cache kerning pairs for some ascii subset of all characters.
-	using AsciiPair = std::uint16_t;
-	using KerningIntType = std::int16_t;
-	using KerningPairs = UnorderedMap< AsciiPair, KerningIntType >;
-	KerningPairs kerning_pair_cache;
+	// Kerning of the character pairs looked up so far.
+	mutable FontKerningCache kerning_cache;
+
+	// The most recently shaped strings, shared by all elements using this handle.
+	FontShapedRunCache shaped_run_cache;
+	// Holds the last shaped run which could not be cached, its buffer is reused between calls.
+	FontShapedRun uncached_run;
 
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
+	// False while the glyphs are loaded without their bitmaps, only their metrics.
+	bool glyph_bitmaps_loaded = true;
 	int version = 0;
 
+	// The handle whose distance field glyphs we scale to render our base layer, if any.
+	FontFaceHandleDefault* distance_field_source = nullptr;
+	bool generate_distance_field = false;
+
+	// Rendered glyphs restored from the font cache, handed over to the layers as they are created.
+	FontCache::LayerMap cached_layers;
+
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
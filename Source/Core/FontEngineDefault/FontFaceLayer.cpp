@@ -28,13 +28,121 @@
 
 #include "FontFaceLayer.h"
 #include "FontFaceHandleDefault.h"
+#include <cmath>
 #include <string.h>
 
 namespace Rml {
 
-FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colour(255, 255, 255)
+// The distance in pixels from the glyph outline to where distance fields saturate, also the padding added around each glyph.
+static constexpr int distance_field_spread = 6;
+
+// Writes the signed distance field of a glyph's coverage bitmap into the alpha channel of the destination, which is padded by the spread on
+// each side. Uses a two-pass sweep propagating the offset to the nearest pixel on the other side of the outline (8SSEDT).
+static void GenerateDistanceField(byte* destination, int destination_stride, const FontGlyph& glyph)
+{
+	const int spread = distance_field_spread;
+	const int width = glyph.bitmap_dimensions.x + 2 * spread;
+	const int height = glyph.bitmap_dimensions.y + 2 * spread;
+	const int num_pixels = width * height;
+
+	auto GetCoverage = [&glyph, spread](int x, int y) -> int {
+		x -= spread;
+		y -= spread;
+		if (!glyph.bitmap_data || x < 0 || y < 0 || x >= glyph.bitmap_dimensions.x || y >= glyph.bitmap_dimensions.y)
+			return 0;
+		return glyph.bitmap_data[y * glyph.bitmap_dimensions.x + x];
+	};
+
+	// The offsets to the nearest pixel outside the glyph, and to the nearest pixel inside it.
+	constexpr int far_away = 1 << 12;
+	Vector<Vector2i> offsets_outside(num_pixels), offsets_inside(num_pixels);
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			const bool inside = (GetCoverage(x, y) >= 128);
+			offsets_outside[y * width + x] = (inside ? Vector2i(far_away) : Vector2i(0));
+			offsets_inside[y * width + x] = (inside ? Vector2i(0) : Vector2i(far_away));
+		}
+	}
+
+	auto Sweep = [width, height](Vector<Vector2i>& offsets) {
+		auto Compare = [&](int x, int y, int dx, int dy) {
+			const int nx = x + dx, ny = y + dy;
+			if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+				return;
+			Vector2i& offset = offsets[y * width + x];
+			const Vector2i candidate = offsets[ny * width + nx] + Vector2i(dx, dy);
+			if (candidate.SquaredMagnitude() < offset.SquaredMagnitude())
+				offset = candidate;
+		};
+
+		for (int y = 0; y < height; y++)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				Compare(x, y, -1, 0);
+				Compare(x, y, 0, -1);
+				Compare(x, y, -1, -1);
+				Compare(x, y, 1, -1);
+			}
+			for (int x = width - 1; x >= 0; x--)
+				Compare(x, y, 1, 0);
+		}
+
+		for (int y = height - 1; y >= 0; y--)
+		{
+			for (int x = width - 1; x >= 0; x--)
+			{
+				Compare(x, y, 1, 0);
+				Compare(x, y, 0, 1);
+				Compare(x, y, -1, 1);
+				Compare(x, y, 1, 1);
+			}
+			for (int x = 0; x < width; x++)
+				Compare(x, y, -1, 0);
+		}
+	};
+
+	Sweep(offsets_outside);
+	Sweep(offsets_inside);
+
+	for (int y = 0; y < height; y++)
+	{
+		byte* row = destination + y * destination_stride;
+		for (int x = 0; x < width; x++)
+		{
+			// The signed distance to the outline in pixels, positive inside the glyph. Pixels partially covered by the outline use their
+			// coverage instead, for sub-pixel precision.
+			const int coverage = GetCoverage(x, y);
+			float distance = 0.f;
+			if (coverage > 0 && coverage < 255)
+				distance = float(coverage) / 255.f - 0.5f;
+			else if (coverage >= 128)
+				distance = std::sqrt(float(offsets_outside[y * width + x].SquaredMagnitude())) - 0.5f;
+			else
+				distance = 0.5f - std::sqrt(float(offsets_inside[y * width + x].SquaredMagnitude()));
+
+			const float value = 0.5f + 0.5f * distance / float(spread);
+			row[x * 4 + 0] = 255;
+			row[x * 4 + 1] = 255;
+			row[x * 4 + 2] = 255;
+			row[x * 4 + 3] = byte(Math::Clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+		}
+	}
+}
+
+// Sets the texture data to transparent white.
+static void ClearTextureData(byte* data, int num_pixels)
+{
+	for (int i = 0; i < num_pixels; i++)
+		((unsigned int*)data)[i] = 0x00ffffff;
+}
+
+FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect, bool _distance_field) : colour(255, 255, 255)
 {
 	effect = _effect;
+	distance_field = (_distance_field && !effect);
 	if (effect)
 		colour = effect->GetColour();
 }
@@ -42,74 +150,87 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 FontFaceLayer::~FontFaceLayer()
 {}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins, float clone_scale)
 {
-	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures.clear();
-	}
-
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
 	// Generate the new layout.
 	if (clone)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+		// Clone the geometry of any new characters from the clone layer.
+		for (auto& pair : clone->character_boxes)
+		{
+			Character character = pair.first;
+			if (character_boxes.find(character) != character_boxes.end())
+				continue;
 
-		// Copy the cloned layer's textures.
-		for (size_t i = 0; i < clone->textures.size(); ++i)
-			textures.push_back(clone->textures[i]);
+			TextureBox box = pair.second;
+			box.origin *= clone_scale;
+			box.dimensions *= clone_scale;
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
-		{
-			for (auto& pair : glyphs)
+			// Request the effect (if we have one) and adjust the origins as appropriate.
+			if (effect && !clone_glyph_origins)
 			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
+				auto it_glyph = glyphs.find(character);
+				if (it_glyph == glyphs.end())
 					continue;
-				}
-
-				TextureBox& box = it->second;
 
 				Vector2i glyph_origin = Vector2i(box.origin);
 				Vector2i glyph_dimensions = Vector2i(box.dimensions);
 
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
 					box.origin = Vector2f(glyph_origin);
 				else
 					box.texture_index = -1;
 			}
+
+			character_boxes[character] = box;
+		}
+
+		// Share the cloned layer's textures, which may have been regenerated since we last cloned them.
+		for (size_t i = 0; i < clone->textures.size(); ++i)
+		{
+			if (i < textures.size())
+				*textures[i] = *clone->textures[i];
+			else
+				textures.push_back(MakeUnique<Texture>(*clone->textures[i]));
 		}
 	}
 	else
 	{
-		// Initialise the texture layout for the glyphs.
+		// Add the new glyphs to the texture layout.
 		character_boxes.reserve(glyphs.size());
 		for (auto& pair : glyphs)
 		{
 			Character character = pair.first;
 			const FontGlyph& glyph = pair.second;
 
+			if (character_boxes.find(character) != character_boxes.end())
+				continue;
+
 			Vector2i glyph_origin(0, 0);
 			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
-			// Adjust glyph origin / dimensions for the font effect.
+			// Adjust glyph origin / dimensions for the font effect. Glyphs without metrics are still recorded so that we don't try them again.
 			if (effect)
 			{
 				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				{
+					character_boxes[character] = TextureBox();
 					continue;
+				}
+			}
+			else if (distance_field)
+			{
+				// Colour glyphs can not be represented by distance fields.
+				if (glyph.color_format != ColorFormat::A8)
+				{
+					character_boxes[character] = TextureBox();
+					continue;
+				}
+
+				glyph_origin = Vector2i(-distance_field_spread);
+				glyph_dimensions += Vector2i(2 * distance_field_spread);
 			}
 
 			TextureBox box;
@@ -126,17 +247,24 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 
 		constexpr int max_texture_dimensions = 1024;
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+		// Generate the texture layout; this will position the new glyph rectangles in the existing textures where possible, or
+		// otherwise in new textures. Rectangles that did not fit are left unplaced and their characters are not rendered.
+		const bool layout_result = texture_layout.GenerateLayout(max_texture_dimensions);
 
+		// The bounds of the new glyphs within each texture.
+		struct DirtyRegion {
+			bool dirty = false;
+			Vector2i top_left, bottom_right;
+		};
+		Vector<DirtyRegion> dirty_regions(texture_layout.GetNumTextures());
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+		// Iterate over each new rectangle in the layout, generating the texture coordinates.
+		for (int i = texture_layout.GetFirstNewRectangle(); i < texture_layout.GetNumRectangles(); ++i)
 		{
 			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+			if (!rectangle.IsPlaced())
+				continue;
+
 			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
 			Character character = (Character)rectangle.GetId();
 			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
@@ -145,6 +273,23 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 			// Set the character's texture index.
 			box.texture_index = rectangle.GetTextureIndex();
 
+			// Extend the texture's dirty region to cover the glyph.
+			DirtyRegion& region = dirty_regions[box.texture_index];
+			const Vector2i rectangle_top_left = rectangle.GetPosition();
+			const Vector2i rectangle_bottom_right = rectangle.GetPosition() + rectangle.GetDimensions();
+			if (!region.dirty)
+			{
+				region.dirty = true;
+				region.top_left = rectangle_top_left;
+				region.bottom_right = rectangle_bottom_right;
+			}
+			else
+			{
+				region.top_left = Vector2i(Math::Min(region.top_left.x, rectangle_top_left.x), Math::Min(region.top_left.y, rectangle_top_left.y));
+				region.bottom_right =
+					Vector2i(Math::Max(region.bottom_right.x, rectangle_bottom_right.x), Math::Max(region.bottom_right.y, rectangle_bottom_right.y));
+			}
+
 			// Generate the character's texture coordinates.
 			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
 			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
@@ -155,9 +300,45 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		const FontEffect* effect_ptr = effect.get();
 		const int handle_version = handle->GetVersion();
 
-		// Generate the textures.
+		// Update the textures which received new glyphs, or generate them if they are new.
 		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
 		{
+			const DirtyRegion& region = dirty_regions[i];
+			if (!region.dirty)
+				continue;
+
+			TextureLayoutTexture& layout_texture = texture_layout.GetTexture(i);
+
+			if (i < (int)textures.size() && textures[i])
+			{
+				if (byte* texture_data = layout_texture.GetTextureData())
+				{
+					// The texture has not been loaded yet, so its data is still waiting to be taken by the texture callback. Write the
+					// new glyphs directly into it.
+					const int stride = layout_texture.GetTextureStride();
+					GenerateTextureRegion(texture_data + region.top_left.y * stride + region.top_left.x * 4, stride, i, region.top_left,
+						region.bottom_right, glyphs);
+					continue;
+				}
+
+				// Only the dirty region needs to be uploaded, render it into a temporary buffer which is released again after the upload.
+				// If the render interface does not support updates the texture is regenerated instead. Then, any geometry referring to
+				// the texture picks up the new handle when it is rendered next time.
+				const Vector2i region_dimensions = region.bottom_right - region.top_left;
+				const int region_stride = region_dimensions.x * 4;
+				UniquePtr<byte[]> region_data(new byte[region_stride * region_dimensions.y]);
+				ClearTextureData(region_data.get(), region_dimensions.x * region_dimensions.y);
+				GenerateTextureRegion(region_data.get(), region_stride, i, region.top_left, region.bottom_right, glyphs);
+
+				textures[i]->Update(region.top_left, region_dimensions, region_data.get(), region_stride);
+				continue;
+			}
+
+			// Render the glyphs into the data of new textures now, so that any cached glyph images are used. The data is handed over
+			// to the texture callback when the texture is loaded.
+			if (byte* texture_data = layout_texture.AllocateTextureData())
+				GenerateTextureRegion(texture_data, layout_texture.GetTextureStride(), i, Vector2i(0), layout_texture.GetDimensions(), glyphs);
+
 			int texture_id = i;
 
 			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
@@ -165,10 +346,18 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 				return result;
 			};
 
-			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
-			textures.push_back(texture);
+			if (i >= (int)textures.size())
+				textures.resize(i + 1);
+			textures[i] = MakeUnique<Texture>();
+
+			textures[i]->Set("font-face-layer", texture_callback, distance_field);
 		}
+
+		// The cached glyphs have been placed in the textures now, any glyphs added later must be rendered.
+		FontCache::LayerGlyphMap().swap(cached_glyphs);
+
+		if (!layout_result)
+			return false;
 	}
 
 	return true;
@@ -178,68 +367,163 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
 	if (texture_id < 0 ||
-		texture_id > texture_layout.GetNumTextures())
+		texture_id >= texture_layout.GetNumTextures())
 		return false;
 
-	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+	TextureLayoutTexture& texture = texture_layout.GetTexture(texture_id);
+	texture_dimensions = texture.GetDimensions();
+
+	// Hand over the data rendered during layer generation if it has not been taken yet. Otherwise, the texture is being generated
+	// again, such as after it was released or could not be updated, so render all of its glyphs again.
+	if (!texture.GetTextureData())
+	{
+		if (byte* data = texture.AllocateTextureData())
+			GenerateTextureRegion(data, texture.GetTextureStride(), texture_id, Vector2i(0), texture_dimensions, glyphs);
+	}
+
+	texture_data = texture.TakeTextureData();
+
+	return true;
+}
+
+void FontFaceLayer::Clear()
+{
+	texture_layout.Clear();
+	character_boxes.clear();
+	textures.clear();
+}
+
+void FontFaceLayer::SetCachedGlyphs(FontCache::LayerGlyphMap _cached_glyphs)
+{
+	cached_glyphs = std::move(_cached_glyphs);
+}
+
+void FontFaceLayer::GetCachedGlyphs(const FontGlyphMap& glyphs, FontCache::LayerGlyphMap& out_cached_glyphs)
+{
+	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (!rectangle.IsPlaced())
+			continue;
+
+		const Character character = Character(rectangle.GetId());
+		auto it_box = character_boxes.find(character);
+		auto it_glyph = glyphs.find(character);
+		if (it_box == character_boxes.end() || it_glyph == glyphs.end())
+			continue;
+
+		// The textures do not keep their data after it has been uploaded, so render the glyph image again.
+		const Vector2i dimensions = rectangle.GetDimensions();
+
+		FontCache::LayerGlyph& glyph = out_cached_glyphs[character];
+		glyph.dimensions = dimensions;
+		glyph.data.resize(size_t(dimensions.x * dimensions.y * 4));
+
+		ClearTextureData(glyph.data.data(), dimensions.x * dimensions.y);
+		GenerateGlyphTextureData(glyph.data.data(), dimensions.x * 4, character, dimensions, it_box->second, it_glyph->second);
+	}
+}
+
+// Renders the glyphs placed on the given texture that overlap the region into the destination, which covers the region.
+void FontFaceLayer::GenerateTextureRegion(byte* destination, int destination_stride, int texture_index, Vector2i region_top_left,
+	Vector2i region_bottom_right, const FontGlyphMap& glyphs)
+{
+	Vector<byte> clipped_data;
 
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 	{
 		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		if (!rectangle.IsPlaced() || rectangle.GetTextureIndex() != texture_index)
+			continue;
 
-		TextureBox& box = character_boxes[character];
+		const Vector2i top_left = rectangle.GetPosition();
+		const Vector2i dimensions = rectangle.GetDimensions();
+		const Vector2i bottom_right = top_left + dimensions;
 
-		if (box.texture_index != texture_id)
+		const Vector2i clip_top_left(Math::Max(top_left.x, region_top_left.x), Math::Max(top_left.y, region_top_left.y));
+		const Vector2i clip_bottom_right(Math::Min(bottom_right.x, region_bottom_right.x), Math::Min(bottom_right.y, region_bottom_right.y));
+		if (clip_top_left.x >= clip_bottom_right.x || clip_top_left.y >= clip_bottom_right.y)
 			continue;
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
+		const Character character = Character(rectangle.GetId());
+		auto it_box = character_boxes.find(character);
+		auto it_glyph = glyphs.find(character);
+		if (it_box == character_boxes.end() || it_glyph == glyphs.end())
 			continue;
 
-		const FontGlyph& glyph = it->second;
+		byte* clip_destination = destination + (clip_top_left.y - region_top_left.y) * destination_stride + (clip_top_left.x - region_top_left.x) * 4;
 
-		if (effect == nullptr)
+		if (clip_top_left == top_left && clip_bottom_right == bottom_right)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			GenerateGlyphTextureData(clip_destination, destination_stride, character, dimensions, it_box->second, it_glyph->second);
+			continue;
+		}
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+		// The glyph is only partially covered by the region, render all of it and copy the covered part.
+		const int stride = dimensions.x * 4;
+		clipped_data.resize(size_t(stride * dimensions.y));
+		ClearTextureData(clipped_data.data(), dimensions.x * dimensions.y);
+		GenerateGlyphTextureData(clipped_data.data(), stride, character, dimensions, it_box->second, it_glyph->second);
+
+		const byte* source = clipped_data.data() + (clip_top_left.y - top_left.y) * stride + (clip_top_left.x - top_left.x) * 4;
+		const int num_bytes_per_line = (clip_bottom_right.x - clip_top_left.x) * 4;
+		for (int j = 0; j < clip_bottom_right.y - clip_top_left.y; ++j)
+			memcpy(clip_destination + j * destination_stride, source + j * stride, num_bytes_per_line);
+	}
+}
+
+// Writes the glyph's image into the destination.
+void FontFaceLayer::GenerateGlyphTextureData(byte* destination, int destination_stride, Character character, Vector2i dimensions,
+	const TextureBox& box, const FontGlyph& glyph)
+{
+	auto it_cached = cached_glyphs.find(character);
+	if (it_cached != cached_glyphs.end() && it_cached->second.dimensions == dimensions)
+	{
+		// Copy the previously rendered glyph image instead of rendering it again.
+		const FontCache::LayerGlyph& cached_glyph = it_cached->second;
+		const int num_bytes_per_line = cached_glyph.dimensions.x * 4;
+
+		for (int j = 0; j < cached_glyph.dimensions.y; ++j)
+			memcpy(destination + j * destination_stride, cached_glyph.data.data() + j * num_bytes_per_line, num_bytes_per_line);
+	}
+	else if (distance_field)
+	{
+		GenerateDistanceField(destination, destination_stride, glyph);
+	}
+	else if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
+		{
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+				case ColorFormat::A8:
+				{
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						destination[k * 4 + 3] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
+				}
+				break;
 				}
+
+				destination += destination_stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
-
-	return true;
+	else
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(box.dimensions), destination_stride, glyph);
+	}
 }
 
 // Returns the effect used to generate the layer.
@@ -254,7 +538,7 @@ const Texture* FontFaceLayer::GetTexture(int index)
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return &(textures[index]);
+	return textures[index].get();
 }
 
 // Returns the number of textures employed by this layer.
@@ -34,6 +34,7 @@
 #include "../../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../TextureLayout.h"
+#include "FontCache.h"
 
 namespace Rml {
 
@@ -50,21 +51,39 @@ class FontFaceHandleDefault;
 class FontFaceLayer
 {
 public:
-	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
+	/// @param[in] effect The font effect generating the layer, or nullptr for the base layer.
+	/// @param[in] distance_field True to generate distance field textures of the glyphs, only supported for the base layer.
+	FontFaceLayer(const SharedPtr<const FontEffect>& effect, bool distance_field = false);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates the character and texture data for the layer. Glyphs that have already been generated are kept in place,
+	/// only new glyphs are packed into the existing textures, and only textures receiving new glyphs are regenerated. The texture
+	/// data is only held until it is uploaded, new glyphs in uploaded textures are rendered into a buffer covering just their region.
 	/// @param[in] handle The handle generating this layer.
-	/// @param[in] effect The effect to initialise the layer with.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
+	/// @param[in] clone_glyph_origins True to keep the glyph origins of the cloned layer, false to adjust them with our effect.
+	/// @param[in] clone_scale The scale applied to the glyph boxes of the cloned layer.
 	/// @return True if the layer was generated successfully, false if not.
-	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
-
-	/// Generates the texture data for a layer (for the texture database).
+	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false,
+		float clone_scale = 1.f);
+
+	/// Removes all glyphs and textures from the layer, so that it can be generated again from scratch.
+	void Clear();
+
+	/// Provides previously rendered images of glyphs, which are copied into the textures during the next generation instead of
+	/// rendering the glyphs again.
+	void SetCachedGlyphs(FontCache::LayerGlyphMap cached_glyphs);
+	/// Retrieves the images of all glyphs rendered into the textures of this layer.
+	/// @param[in] glyphs The glyphs of the handle generating this layer, used to render the images again.
+	/// @param[out] out_cached_glyphs The glyph images, by character.
+	void GetCachedGlyphs(const FontGlyphMap& glyphs, FontCache::LayerGlyphMap& out_cached_glyphs);
+
+	/// Generates the texture data for a layer (for the texture database). The data rendered when the texture was created is handed
+	/// over if it is still held, after which the layer keeps no copy of it. Otherwise, the texture is rendered again from the glyphs.
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
 	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
+	/// @param[in] glyphs The glyphs of the handle generating this layer.
 	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
 
 	/// Generates the geometry required to render a single character.
@@ -113,8 +132,6 @@ public:
 	Colourb GetColour() const;
 
 private:
-
-
 	struct TextureBox
 	{
 		TextureBox() : texture_index(-1) { }
@@ -130,15 +147,25 @@ private:
 		int texture_index;
 	};
 
+	// Renders the glyphs placed on the given texture that overlap the region into the destination, which covers the region.
+	void GenerateTextureRegion(byte* destination, int destination_stride, int texture_index, Vector2i region_top_left,
+		Vector2i region_bottom_right, const FontGlyphMap& glyphs);
+	// Writes the glyph's image, of the given dimensions, into the destination.
+	void GenerateGlyphTextureData(byte* destination, int destination_stride, Character character, Vector2i dimensions, const TextureBox& box,
+		const FontGlyph& glyph);
+
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<Texture>;
+	// Textures are referenced by the geometry of generated strings, thus their addresses must be stable.
+	using TextureList = Vector<UniquePtr<Texture>>;
 
 	SharedPtr<const FontEffect> effect;
+	bool distance_field;
 
 	TextureLayout texture_layout;
 
 	CharacterMap character_boxes;
 	TextureList textures;
+	FontCache::LayerGlyphMap cached_glyphs;
 	Colourb colour;
 };
 
@@ -95,4 +95,10 @@ void FontFamily::ReleaseFontResources()
 		entry.face->ReleaseFontResources();
 }
 
+void FontFamily::GetCacheEntries(FontCache::EntryList& entries)
+{
+	for (auto& entry : font_faces)
+		entry.face->GetCacheEntries(entries);
+}
+
 } // namespace Rml
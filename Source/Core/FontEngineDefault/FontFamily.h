@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 
+#include "FontCache.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -64,6 +65,9 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
+	/// Adds a font cache entry for each sized font face.
+	void GetCacheEntries(FontCache::EntryList& entries);
+
 protected:
 	String name;
 
@@ -0,0 +1,114 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontKerningCache.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include <algorithm>
+
+namespace Rml {
+
+static constexpr size_t min_num_slots = 64;
+// Limits the memory of each cache to 80 kB, holding up to half as many pairs.
+static constexpr size_t max_num_slots = 8192;
+
+void FontKerningCache::Insert(Character lhs, Character rhs, int kerning)
+{
+	const uint64_t key = GetKey(lhs, rhs);
+	const int16_t value = int16_t(Math::Clamp(kerning, -32768, 32767));
+
+	// Overwrite the pair if it is already in the cache, such as when restored from a font cache with duplicate pairs.
+	if (!keys.empty())
+	{
+		for (size_t i = GetSlot(key); keys[i] != empty_key; i = (i + 1) & (keys.size() - 1))
+		{
+			if (keys[i] == key)
+			{
+				values[i] = value;
+				return;
+			}
+		}
+	}
+
+	// Keep the table at most half full, so that probe sequences stay short.
+	if (2 * (num_pairs + 1) > keys.size())
+	{
+		if (keys.size() < max_num_slots)
+		{
+			Rehash(Math::Max(min_num_slots, 2 * keys.size()));
+		}
+		else
+		{
+			// The cache is full, start over with the pairs used from now on.
+			std::fill(keys.begin(), keys.end(), empty_key);
+			num_pairs = 0;
+		}
+	}
+
+	size_t i = GetSlot(key);
+	while (keys[i] != empty_key)
+		i = (i + 1) & (keys.size() - 1);
+
+	keys[i] = key;
+	values[i] = value;
+	num_pairs += 1;
+}
+
+void FontKerningCache::Clear()
+{
+	Vector<uint64_t>().swap(keys);
+	Vector<int16_t>().swap(values);
+	num_pairs = 0;
+}
+
+void FontKerningCache::Rehash(size_t num_slots)
+{
+	RMLUI_ASSERT(num_slots > 0 && (num_slots & (num_slots - 1)) == 0);
+
+	Vector<uint64_t> old_keys(num_slots, empty_key);
+	Vector<int16_t> old_values(num_slots, 0);
+	old_keys.swap(keys);
+	old_values.swap(values);
+	num_pairs = 0;
+
+	for (size_t i = 0; i < old_keys.size(); i++)
+	{
+		if (old_keys[i] == empty_key)
+			continue;
+
+		const uint64_t key = old_keys[i];
+		size_t slot = GetSlot(key);
+		while (keys[slot] != empty_key)
+			slot = (slot + 1) & (keys.size() - 1);
+
+		keys[slot] = key;
+		values[slot] = old_values[i];
+		num_pairs += 1;
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,105 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTKERNINGCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTKERNINGCACHE_H
+
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	A bounded cache of kerning values for pairs of characters, using open addressing with linear probing.
+
+	Pairs are added as they are looked up, including pairs without kerning. The table grows up to a fixed size, once it is
+	full the cache is cleared and filled again from the pairs in use.
+ */
+
+class FontKerningCache
+{
+public:
+	/// Looks up the kerning of a character pair.
+	/// @param[out] out_kerning The kerning of the pair, if found.
+	/// @return True if the pair is in the cache.
+	bool Find(Character lhs, Character rhs, int& out_kerning) const
+	{
+		if (keys.empty())
+			return false;
+
+		const uint64_t key = GetKey(lhs, rhs);
+		for (size_t i = GetSlot(key);; i = (i + 1) & (keys.size() - 1))
+		{
+			if (keys[i] == key)
+			{
+				out_kerning = values[i];
+				return true;
+			}
+			if (keys[i] == empty_key)
+				return false;
+		}
+	}
+
+	/// Adds the kerning of a character pair, or replaces it if the pair is already in the cache.
+	void Insert(Character lhs, Character rhs, int kerning);
+
+	/// Removes all pairs and releases the table.
+	void Clear();
+
+	/// Calls the function with (lhs, rhs, kerning) for every pair in the cache.
+	template <typename Func>
+	void ForEachPair(Func&& func) const
+	{
+		for (size_t i = 0; i < keys.size(); i++)
+		{
+			if (keys[i] != empty_key)
+				func(Character(keys[i] >> 32), Character(keys[i] & 0xffffffff), int(values[i]));
+		}
+	}
+
+	/// Returns the number of pairs in the cache.
+	size_t GetNumPairs() const { return num_pairs; }
+	/// Returns the memory allocated by the cache, in bytes.
+	size_t GetMemoryUsage() const { return keys.capacity() * sizeof(uint64_t) + values.capacity() * sizeof(int16_t); }
+
+private:
+	// Not a valid pair, code points are limited to 21 bits.
+	static constexpr uint64_t empty_key = ~uint64_t(0);
+
+	static uint64_t GetKey(Character lhs, Character rhs) { return (uint64_t(lhs) << 32) | uint64_t(rhs); }
+	size_t GetSlot(uint64_t key) const { return size_t((key * 0x9E3779B97F4A7C15ull) >> 32) & (keys.size() - 1); }
+
+	// Resizes the table to the given number of slots, a power of two, re-inserting all pairs.
+	void Rehash(size_t num_slots);
+
+	Vector<uint64_t> keys;
+	Vector<int16_t> values;
+	size_t num_pairs = 0;
+};
+
+} // namespace Rml
+#endif
@@ -35,6 +35,7 @@
 #include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Math.h"
+#include "../../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include <algorithm>
 
@@ -42,6 +43,9 @@ namespace Rml {
 
 static FontProvider* g_font_provider = nullptr;
 
+// Set independently of the font provider, so that it can be enabled before initialization.
+static bool g_distance_field_rendering = false;
+
 FontProvider::FontProvider()
 {
 	RMLUI_ASSERT(!g_font_provider);
@@ -66,6 +70,7 @@ void FontProvider::Shutdown()
 	RMLUI_ASSERT(g_font_provider);
 	delete g_font_provider;
 	g_font_provider = nullptr;
+	g_distance_field_rendering = false;
 	FreeType::Shutdown();
 }
 
@@ -103,6 +108,17 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 	return nullptr;
 }
 
+void FontProvider::SetDistanceFieldRendering(bool enable)
+{
+	g_distance_field_rendering = enable;
+}
+
+bool FontProvider::IsDistanceFieldRenderingEnabled()
+{
+	RenderInterface* render_interface = GetRenderInterface();
+	return g_distance_field_rendering && render_interface && render_interface->SupportsDistanceFieldTextures();
+}
+
 void FontProvider::ReleaseFontResources()
 {
 	RMLUI_ASSERT(g_font_provider);
@@ -110,6 +126,27 @@ void FontProvider::ReleaseFontResources()
 		name_family.second->ReleaseFontResources();
 }
 
+bool FontProvider::LoadFontCache(const String& file_path)
+{
+	return Get().font_cache.Load(file_path);
+}
+
+bool FontProvider::SaveFontCache(const String& file_path)
+{
+	FontProvider& provider = Get();
+
+	FontCache::EntryList entries;
+	for (auto& name_family : provider.font_families)
+		name_family.second->GetCacheEntries(entries);
+
+	return provider.font_cache.Save(file_path, entries);
+}
+
+FontCache& FontProvider::GetFontCache()
+{
+	return Get().font_cache;
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -31,6 +31,7 @@
 
 #include "../../../Include/RmlUi/Core/Types.h"
 #include "../../../Include/RmlUi/Core/StyleTypes.h"
+#include "FontCache.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -72,9 +73,21 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Enables rendering from distance field glyphs for sizes used from now on, see Rml::SetFontDistanceFieldRendering().
+	static void SetDistanceFieldRendering(bool enable);
+	/// Returns true if distance field rendering is enabled and supported by the render interface.
+	static bool IsDistanceFieldRenderingEnabled();
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Loads a font cache file for restoring font sizes used from now on, see Rml::LoadFontCache().
+	static bool LoadFontCache(const String& file_path);
+	/// Writes all font sizes in use to a font cache file, see Rml::SaveFontCache().
+	static bool SaveFontCache(const String& file_path);
+	/// Returns the entries loaded from the font cache file which have not yet been used.
+	static FontCache& GetFontCache();
+
 private:
 	FontProvider();
 	~FontProvider();
@@ -93,6 +106,8 @@ private:
 	FontFamilyMap font_families;
 	FontFaceList fallback_font_faces;
 
+	FontCache font_cache;
+
 	static const String debugger_font_family_name;
 	
 };
@@ -0,0 +1,80 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontShapedRunCache.h"
+
+namespace Rml {
+
+// Longer strings, such as the lines of paragraphs, are rarely repeated.
+static constexpr size_t max_cached_string_length = 128;
+// Limits the memory of each cache to about 200 kB of glyphs, along with their strings.
+static constexpr size_t max_cached_glyphs = 16384;
+
+const FontShapedRun* FontShapedRunCache::Find(const String& string)
+{
+	auto it = entry_map.find(string);
+	if (it == entry_map.end())
+		return nullptr;
+
+	entries.splice(entries.begin(), entries, it->second);
+	return &it->second->second;
+}
+
+const FontShapedRun* FontShapedRunCache::Insert(const String& string, FontShapedRun&& run)
+{
+	RMLUI_ASSERT(entry_map.find(string) == entry_map.end());
+
+	num_glyphs += run.glyphs.size();
+	entries.emplace_front(string, std::move(run));
+	entry_map.emplace(string, entries.begin());
+
+	// Evict the least recently used runs, always keeping the new one.
+	while (num_glyphs > max_cached_glyphs && entries.size() > 1)
+	{
+		Entry& entry = entries.back();
+		num_glyphs -= entry.second.glyphs.size();
+		entry_map.erase(entry.first);
+		entries.pop_back();
+	}
+
+	return &entries.front().second;
+}
+
+void FontShapedRunCache::Clear()
+{
+	entries.clear();
+	entry_map.clear();
+	num_glyphs = 0;
+}
+
+bool FontShapedRunCache::IsCacheable(size_t string_length)
+{
+	return string_length <= max_cached_string_length;
+}
+
+} // namespace Rml
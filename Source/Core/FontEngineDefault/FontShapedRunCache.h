@@ -0,0 +1,85 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTSHAPEDRUNCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTSHAPEDRUNCACHE_H
+
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	The glyphs of a string positioned along its baseline, with kerning applied.
+ */
+
+struct FontShapedRun {
+	struct Glyph {
+		// The character rendered, may differ from the string such as for the replacement character.
+		Character character;
+		// The horizontal offset of the glyph from the start of the string.
+		int offset;
+		// True if the glyph has its own colours, and is rendered with white vertex colours.
+		bool colour_glyph;
+	};
+
+	Vector<Glyph> glyphs;
+	int width = 0;
+};
+
+/**
+	A least-recently-used cache of shaped runs by their string, bounded by the total number of glyphs.
+ */
+
+class FontShapedRunCache
+{
+public:
+	/// Returns the run of the given string if it is cached, and marks it as most recently used.
+	const FontShapedRun* Find(const String& string);
+
+	/// Adds the run of a string not already in the cache, evicting the least recently used runs as necessary.
+	/// @return The cached run.
+	const FontShapedRun* Insert(const String& string, FontShapedRun&& run);
+
+	/// Removes all runs.
+	void Clear();
+
+	/// Returns true if a string of the given length may be cached.
+	static bool IsCacheable(size_t string_length);
+
+private:
+	using Entry = Pair<String, FontShapedRun>;
+	using EntryList = List<Entry>;
+
+	// Ordered from most to least recently used.
+	EntryList entries;
+	UnorderedMap<String, EntryList::iterator> entry_map;
+	size_t num_glyphs = 0;
+};
+
+} // namespace Rml
+#endif
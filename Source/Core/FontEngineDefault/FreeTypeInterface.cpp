@@ -42,8 +42,8 @@ namespace Rml {
 
 static FT_Library ft_library = nullptr;
 
-static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor);
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs);
+static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_bitmap);
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs, bool load_bitmaps);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_scaling_factor);
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor);
 static void BitmapDownscale(byte* bitmap_new, int new_width, int new_height, const byte* bitmap_source, int width, int height, int pitch,
@@ -192,8 +192,22 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 	}
 }
 
+// Retrieves the font data the face was loaded from, the data is owned by the font face.
+bool FreeType::GetFaceData(FontFaceHandleFreetype face, const byte*& out_data, size_t& out_data_length, long& out_face_index)
+{
+	FT_Face ft_face = (FT_Face)face;
+	if (!ft_face || !ft_face->stream || !ft_face->stream->base)
+		return false;
+
+	out_data = (const byte*)ft_face->stream->base;
+	out_data_length = (size_t)ft_face->stream->size;
+	out_face_index = ft_face->face_index;
+	return true;
+}
+
 // Initialises the handle so it is able to render text.
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	bool load_bitmaps)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -204,7 +218,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 		return false;
 
 	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
+	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs, load_bitmaps);
 
 	// Generate the metrics for the handle.
 	GenerateMetrics(ft_face, metrics, bitmap_scaling_factor);
@@ -212,7 +226,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	return true;
 }
 
-bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs)
+bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, bool load_bitmaps)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -224,7 +238,7 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
 		return false;
 
-	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor))
+	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor, load_bitmaps))
 		return false;
 
 	return true;
@@ -270,9 +284,17 @@ bool FreeType::HasKerning(FontFaceHandleFreetype face)
 	return FT_HAS_KERNING(ft_face);
 }
 
+bool FreeType::HasColourGlyphs(FontFaceHandleFreetype face)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	return FT_HAS_COLOR(ft_face);
+}
+
 
 
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs)
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs,
+	const bool load_bitmaps)
 {
 	if (load_default_glyphs)
 	{
@@ -283,7 +305,7 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 		FT_ULong code_max = 126;
 
 		for (FT_ULong character_code = code_min; character_code <= code_max; ++character_code)
-			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor);
+			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor, load_bitmaps);
 	}
 
 	// Add a replacement character for rendering unknown characters.
@@ -315,7 +337,7 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 	}
 }
 
-static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor)
+static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_bitmap)
 {
 	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
 	if (index == 0)
@@ -328,7 +350,8 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	// The glyph metrics are available once loaded, only render the glyph when we need its bitmap.
+	error = (load_bitmap ? FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL) : 0);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character, ft_face->family_name, ft_face->style_name, error);
@@ -371,6 +394,13 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		glyph.bitmap_dimensions = Vector2i(Vector2f(glyph.bitmap_dimensions) * bitmap_scaling_factor);
 	}
 
+	// Only the metrics are needed when the glyph is not rendered.
+	if (!load_bitmap)
+	{
+		glyph.bitmap_dimensions = Vector2i(0);
+		return true;
+	}
+
 	// Copy the glyph's bitmap data from the FreeType glyph handle to our glyph handle.
 	if (glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y != 0)
 	{
@@ -52,11 +52,19 @@ bool ReleaseFace(FontFaceHandleFreetype face);
 // Retrieves the font family, style and weight of the given font face. Use nullptr to ignore a property.
 void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
+// Retrieves the font data in memory which the face was loaded from, and the index of the face within the data.
+bool GetFaceData(FontFaceHandleFreetype face, const byte*& out_data, size_t& out_data_length, long& out_face_index);
+
 // Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+// Without 'load_bitmaps', only the metrics of the glyphs are loaded, and their bitmaps are left empty.
+bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	bool load_bitmaps);
 
 // Build a new glyph representing the given code point and append to 'glyphs'.
-bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
+bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, bool load_bitmaps);
+
+// Returns true if the font face may contain colour glyphs.
+bool HasColourGlyphs(FontFaceHandleFreetype face);
 
 // Returns the kerning between two characters.
 // 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
@@ -30,9 +30,11 @@
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "GeometryDatabase.h"
+#include "RenderCommandList.h"
 #include <utility>
 
 
@@ -70,8 +72,12 @@ void Geometry::MoveFrom(Geometry& other) noexcept
 	indices = std::move(other.indices);
 
 	texture = std::exchange(other.texture, nullptr);
+	colour_multiplier = std::exchange(other.colour_multiplier, Colourb(255));
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
+	compiled_texture = std::exchange(other.compiled_texture, 0);
+	compiled_colour_multiplier = std::exchange(other.compiled_colour_multiplier, Colourb(255));
+	multiplied_vertices = std::move(other.multiplied_vertices);
 	compile_attempted = std::exchange(other.compile_attempted, false);
 }
 
@@ -105,11 +111,33 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	// Record the geometry for batching when enabled on the context, the local vertices are kept around even after compilation.
+	if (RenderCommandList* render_commands = (host_context ? host_context->active_render_commands : nullptr))
+	{
+		if (!vertices.empty() && !indices.empty())
+			render_commands->AddGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
+				texture ? texture->GetHandle(render_interface) : 0, translation, colour_multiplier);
+		return;
+	}
+
+	// The texture may have been regenerated since the geometry was compiled, such as when glyphs are added to a font texture. Then we need
+	// to compile the geometry again with the new texture handle.
+	if (compiled_geometry && texture && texture->GetHandle(render_interface) != compiled_texture)
+		Release();
+
+	// Colour multipliers are either applied by the render interface, or otherwise to the vertices when compiling the geometry.
+	const bool render_colour_multiplier =
+		(host_context ? host_context->render_colour_multiplier : render_interface->SupportsColourMultiplier());
+	const Colourb vertex_colour_multiplier = (render_colour_multiplier ? Colourb(255) : colour_multiplier);
+
+	if (compile_attempted && compiled_colour_multiplier != vertex_colour_multiplier)
+		Release();
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
-		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+		RenderCompiled(render_interface, translation, render_colour_multiplier);
 	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
 	// immediate mode.
@@ -124,23 +152,48 @@ void Geometry::Render(Vector2f translation)
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+			compiled_texture = (texture ? texture->GetHandle(render_interface) : 0);
+			compiled_colour_multiplier = vertex_colour_multiplier;
+
+			// Multiply the vertex colours on a copy of the vertices, leaving our own vertices unchanged. The copy is kept for rendering in
+			// immediate mode until the geometry is released, such as when the multiplier changes.
+			multiplied_vertices.clear();
+			if (vertex_colour_multiplier != Colourb(255))
+			{
+				multiplied_vertices = vertices;
+				for (Vertex& vertex : multiplied_vertices)
+					vertex.colour = Math::MultiplyColour(vertex.colour, vertex_colour_multiplier);
+			}
+
+			Vertex* render_vertices = (multiplied_vertices.empty() ? &vertices[0] : &multiplied_vertices[0]);
+			compiled_geometry = render_interface->CompileGeometry(render_vertices, (int)vertices.size(), &indices[0], (int)indices.size(), compiled_texture);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
 			if (compiled_geometry)
 			{	
-				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+				Vector<Vertex>().swap(multiplied_vertices);
+				RenderCompiled(render_interface, translation, render_colour_multiplier);
 				return;
 			}
 		}
 
+		Vertex* render_vertices = (multiplied_vertices.empty() ? &vertices[0] : &multiplied_vertices[0]);
+
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		render_interface->RenderGeometry(render_vertices, (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
 	}
 }
 
+void Geometry::RenderCompiled(RenderInterface* render_interface, Vector2f translation, bool render_colour_multiplier)
+{
+	if (render_colour_multiplier && colour_multiplier != Colourb(255))
+		render_interface->RenderCompiledGeometryWithColour(compiled_geometry, translation, colour_multiplier);
+	else
+		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+}
+
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 Vector< Vertex >& Geometry::GetVertices()
 {
@@ -166,6 +219,16 @@ void Geometry::SetTexture(const Texture* _texture)
 	Release();
 }
 
+void Geometry::SetColourMultiplier(Colourb _colour_multiplier)
+{
+	colour_multiplier = _colour_multiplier;
+}
+
+Colourb Geometry::GetColourMultiplier() const
+{
+	return colour_multiplier;
+}
+
 void Geometry::Release(bool clear_buffers)
 {
 	if (compiled_geometry)
@@ -174,7 +237,10 @@ void Geometry::Release(bool clear_buffers)
 		compiled_geometry = 0;
 	}
 
+	compiled_texture = 0;
+	compiled_colour_multiplier = Colourb(255);
 	compile_attempted = false;
+	multiplied_vertices.clear();
 
 	if (clear_buffers)
 	{
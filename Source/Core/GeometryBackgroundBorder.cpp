@@ -34,10 +34,14 @@
 
 namespace Rml {
 
-GeometryBackgroundBorder::GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices) : vertices(vertices), indices(indices)
+GeometryBackgroundBorder::GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices, const Colourb* colours,
+	Vector<ColourSource>* colour_sources) :
+	vertices(vertices),
+	indices(indices), colours(colours), colour_sources(colour_sources)
 {}
 
-void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, const Vector2f offset, const Colourb background_color, const Colourb* border_colors)
+void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, const Vector2f offset,
+	const Colourb background_color, const Colourb* border_colors, Vector<ColourSource>* colour_sources)
 {
 	using Edge = Box::Edge;
 
@@ -133,7 +137,15 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 
 	// -- Generate the geometry --
 
-	GeometryBackgroundBorder geometry(vertices, indices);
+	const Colourb colours[NUM_COLOURS] = {
+		background_color,
+		border_colors ? border_colors[Edge::TOP] : Colourb(),
+		border_colors ? border_colors[Edge::RIGHT] : Colourb(),
+		border_colors ? border_colors[Edge::BOTTOM] : Colourb(),
+		border_colors ? border_colors[Edge::LEFT] : Colourb(),
+	};
+
+	GeometryBackgroundBorder geometry(vertices, indices, colours, colour_sources);
 
 	{
 		// Reserve geometry. A conservative estimate, does not take border-radii into account and assumes same-colored borders.
@@ -150,7 +162,7 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 		const int offset_vertices = (int)vertices.size();
 
 		for (int corner = 0; corner < 4; corner++)
-			geometry.DrawBackgroundCorner(Corner(corner), positions_inner[corner], positions_circle_center[corner], radii[corner], inner_radii[corner], background_color);
+			geometry.DrawBackgroundCorner(Corner(corner), positions_inner[corner], positions_circle_center[corner], radii[corner], inner_radii[corner], BACKGROUND);
 
 		geometry.FillBackground(offset_vertices);
 	}
@@ -182,7 +194,7 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 
 			if (draw_corner[corner])
 				geometry.DrawBorderCorner(Corner(corner), positions_outer[corner], positions_inner[corner], positions_circle_center[corner],
-					radii[corner], inner_radii[corner], border_colors[edge0], border_colors[edge1]);
+					radii[corner], inner_radii[corner], BORDER + edge0, BORDER + edge1);
 
 			if (draw_edge[edge1])
 			{
@@ -209,6 +221,8 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 	}
 #endif
 
+	RMLUI_ASSERT(!colour_sources || colour_sources->size() == vertices.size());
+
 #ifdef RMLUI_DEBUG
 	const int num_vertices = (int)vertices.size();
 	for (int index : indices)
@@ -220,7 +234,21 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 
 
 
-void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color)
+void GeometryBackgroundBorder::Recolour(Vector<Vertex>& vertices, const Vector<ColourSource>& colour_sources, Colourb background_color,
+	const Colourb* border_colors)
+{
+	RMLUI_ASSERT(vertices.size() == colour_sources.size());
+
+	const Colourb colours[NUM_COLOURS] = {background_color, border_colors[0], border_colors[1], border_colors[2], border_colors[3]};
+
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		const ColourSource& source = colour_sources[i];
+		vertices[i].colour = Math::RoundedLerp(source.t, colours[source.colour0], colours[source.colour1]);
+	}
+}
+
+void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, int color)
 {
 	if (R == 0 || r.x <= 0 || r.y <= 0)
 	{
@@ -235,23 +263,23 @@ void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_
 	}
 }
 
-void GeometryBackgroundBorder::DrawPoint(Vector2f pos, Colourb color)
+void GeometryBackgroundBorder::DrawPoint(Vector2f pos, int color)
 {
 	const int offset_vertices = (int)vertices.size();
 
-	vertices.resize(offset_vertices + 1);
+	Resize(offset_vertices + 1);
 
 	vertices[offset_vertices].position = pos;
-	vertices[offset_vertices].colour = color;
+	SetColour(offset_vertices, 0.f, color, color);
 }
 
-void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, float a0, float a1, int color0, int color1, int num_points)
 {
 	RMLUI_ASSERT(num_points >= 2 && r.x > 0 && r.y > 0);
 
 	const int offset_vertices = (int)vertices.size();
 
-	vertices.resize(offset_vertices + num_points);
+	Resize(offset_vertices + num_points);
 
 	for (int i = 0; i < num_points; i++)
 	{
@@ -262,7 +290,7 @@ void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, float a0
 		const Vector2f unit_vector(Math::Cos(a), Math::Sin(a));
 
 		vertices[offset_vertices + i].position = unit_vector * r + pos_center;
-		vertices[offset_vertices + i].colour = Math::RoundedLerp(t, color0, color1);
+		SetColour(offset_vertices + i, t, color0, color1);
 	}
 }
 
@@ -283,7 +311,7 @@ void GeometryBackgroundBorder::FillBackground(int index_start)
 	}
 }
 
-void GeometryBackgroundBorder::DrawBorderCorner(Corner corner, Vector2f pos_outer, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color0, Colourb color1)
+void GeometryBackgroundBorder::DrawBorderCorner(Corner corner, Vector2f pos_outer, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, int color0, int color1)
 {
 	const float a0 = float((int)corner + 2) * 0.5f * Math::RMLUI_PI;
 	const float a1 = float((int)corner + 3) * 0.5f * Math::RMLUI_PI;
@@ -302,9 +330,9 @@ void GeometryBackgroundBorder::DrawBorderCorner(Corner corner, Vector2f pos_oute
 	}
 }
 
-void GeometryBackgroundBorder::DrawPointPoint(Vector2f pos_outer, Vector2f pos_inner, Colourb color0, Colourb color1)
+void GeometryBackgroundBorder::DrawPointPoint(Vector2f pos_outer, Vector2f pos_inner, int color0, int color1)
 {
-	const bool different_color = (color0 != color1);
+	const bool different_color = (colours[color0] != colours[color1]);
 
 	vertices.reserve((int)vertices.size() + (different_color ? 4 : 2));
 
@@ -318,7 +346,7 @@ void GeometryBackgroundBorder::DrawPointPoint(Vector2f pos_outer, Vector2f pos_i
 	}
 }
 
-void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f r, float a0, float a1, int color0, int color1, int num_points)
 {
 	RMLUI_ASSERT(num_points >= 2 && R > 0 && r.x > 0 && r.y > 0);
 
@@ -327,7 +355,7 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 	const int offset_vertices = (int)vertices.size();
 	const int offset_indices = (int)indices.size();
 
-	vertices.resize(offset_vertices + 2 * num_points);
+	Resize(offset_vertices + 2 * num_points);
 	indices.resize(offset_indices + 3 * num_triangles);
 
 	for (int i = 0; i < num_points; i++)
@@ -335,13 +363,12 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 		const float t = float(i) / float(num_points - 1);
 
 		const float a = Math::Lerp(t, a0, a1);
-		const Colourb color = Math::RoundedLerp(t, color0, color1);
 		const Vector2f unit_vector(Math::Cos(a), Math::Sin(a));
 
 		vertices[offset_vertices + 2 * i].position = unit_vector * r + pos_center;
-		vertices[offset_vertices + 2 * i].colour = color;
+		SetColour(offset_vertices + 2 * i, t, color0, color1);
 		vertices[offset_vertices + 2 * i + 1].position = unit_vector * R + pos_center;
-		vertices[offset_vertices + 2 * i + 1].colour = color;
+		SetColour(offset_vertices + 2 * i + 1, t, color0, color1);
 	}
 
 	for (int i = 0; i < num_triangles; i += 2)
@@ -356,7 +383,7 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 	}
 }
 
-void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, int color0, int color1, int num_points)
 {
 	RMLUI_ASSERT(R > 0 && num_points >= 2);
 
@@ -416,4 +443,18 @@ int GeometryBackgroundBorder::GetNumPoints(float R) const
 	return Math::Clamp(3 + Math::RoundToInteger(R / 6.f), 2, 100);
 }
 
+void GeometryBackgroundBorder::Resize(int num_vertices)
+{
+	vertices.resize(num_vertices);
+	if (colour_sources)
+		colour_sources->resize(num_vertices);
+}
+
+void GeometryBackgroundBorder::SetColour(int vertex_index, float t, int color0, int color1)
+{
+	vertices[vertex_index].colour = Math::RoundedLerp(t, colours[color0], colours[color1]);
+	if (colour_sources)
+		(*colour_sources)[vertex_index] = ColourSource{byte(color0), byte(color1), t};
+}
+
 } // namespace Rml
@@ -47,6 +47,12 @@ using CornerPositions = Array<Vector2f, 4>;
 
 class GeometryBackgroundBorder {
 public:
+	/// Describes how the colour of a generated vertex is interpolated from the background and border colours. Colour indices refer to the
+	/// background (0), followed by the border colours in top-right-bottom-left order (1-4).
+	struct ColourSource {
+		byte colour0, colour1;
+		float t;
+	};
 
 	/// Generate geometry for background and borders.
 	/// @param[out] vertices Destination vector for generated vertices.
@@ -56,24 +62,38 @@ public:
 	/// @param[in] offset Offset the position of the generated vertices.
 	/// @param[in] background_color Color of the background, set alpha to zero to not generate a background.
 	/// @param[in] border_colors Pointer to a four-element array of border colors in top-right-bottom-left order, or nullptr to not generate borders.
-	static void Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, Vector2f offset, Colourb background_color, const Colourb* border_colors);
+	/// @param[out] colour_sources Optional destination for the colour source of each generated vertex, kept in step with the vertices.
+	static void Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, Vector2f offset, Colourb background_color,
+		const Colourb* border_colors, Vector<ColourSource>* colour_sources = nullptr);
+
+	/// Recolour previously generated vertices in place from their colour sources.
+	/// @note The result is only correct if the same vertices would be generated with the new colours, that is, if the background and
+	/// each border edge are still visible or transparent as before, and adjacent border edges still have equal or different colours.
+	/// @param[in,out] vertices The vertices to recolour.
+	/// @param[in] colour_sources The colour sources generated along with the vertices.
+	/// @param[in] background_color The new background color.
+	/// @param[in] border_colors Pointer to a four-element array of the new border colors in top-right-bottom-left order.
+	static void Recolour(Vector<Vertex>& vertices, const Vector<ColourSource>& colour_sources, Colourb background_color, const Colourb* border_colors);
 
 private:
 	enum Corner { TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT };
 
-	GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices);
+	// Indices into the colours, see ColourSource.
+	enum ColourIndex { BACKGROUND = 0, BORDER = 1, NUM_COLOURS = 5 };
+
+	GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices, const Colourb* colours, Vector<ColourSource>* colour_sources);
 
 	// -- Background --
 	// All draw operations place vertices in clockwise order.
 
 	// Draw the corner, delegate to the specific corner shape drawing function.
-	void DrawBackgroundCorner(Corner corner, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color);
+	void DrawBackgroundCorner(Corner corner, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, int color);
 
 	// Add a single point.
-	void DrawPoint(Vector2f pos, Colourb color);
+	void DrawPoint(Vector2f pos, int color);
 
 	// Draw an arc by placing vertices along the ellipse formed by the two-axis radius r, spaced evenly between angles a0,a1 (inclusive). Colors are interpolated.
-	void DrawArc(Vector2f pos_center, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points);
+	void DrawArc(Vector2f pos_center, Vector2f r, float a0, float a1, int color0, int color1, int num_points);
 
 	// Generates triangles by connecting the added vertices.
 	void FillBackground(int index_start);
@@ -89,17 +109,17 @@ private:
 	// Where 'next' corner means along the clockwise direction. This way we can easily fill the triangles of the edges in FillEdge().
 
 	// Draw the corner, delegate to the specific corner shape drawing function.
-	void DrawBorderCorner(Corner corner, Vector2f pos_outer, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color0, Colourb color1);
+	void DrawBorderCorner(Corner corner, Vector2f pos_outer, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, int color0, int color1);
 
 	// Draw a sharp border corner, ie. no border-radius. Does not produce any triangles.
-	void DrawPointPoint(Vector2f pos_outer, Vector2f pos_inner, Colourb color0, Colourb color1);
+	void DrawPointPoint(Vector2f pos_outer, Vector2f pos_inner, int color0, int color1);
 
 	// Draw an arc along the outer edge (radius R), and an arc along the inner edge (two-axis radius r),
 	// spaced evenly between angles a0,a1 (inclusive). Connect them by triangles. Colors are interpolated.
-	void DrawArcArc(Vector2f pos_center, float R, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points);
+	void DrawArcArc(Vector2f pos_center, float R, Vector2f r, float a0, float a1, int color0, int color1, int num_points);
 
 	// Draw an arc along the outer edge, and connect them by triangles to a point on the inner edge.
-	void DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, Colourb color0, Colourb color1, int num_points);
+	void DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, int color0, int color1, int num_points);
 
 	// Add triangles between the previous corner to another one specified by the index (possibly yet-to-be-drawn).
 	void FillEdge(int index_next_corner);
@@ -108,8 +128,16 @@ private:
 	// -- Tools --
 	int GetNumPoints(float R) const;
 
+	// Resize the vertices, along with their colour sources if requested.
+	void Resize(int num_vertices);
+
+	// Set the colour of a vertex by interpolating between two of the colours, and record its colour source if requested.
+	void SetColour(int vertex_index, float t, int color0, int color1);
+
 	Vector<Vertex>& vertices;
 	Vector<int>& indices;
+	const Colourb* colours;
+	Vector<ColourSource>* colour_sources;
 };
 
 } // namespace Rml
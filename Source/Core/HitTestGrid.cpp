@@ -0,0 +1,209 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "TransformState.h"
+#include <cmath>
+
+namespace Rml {
+
+// Size of each cell in pixels.
+static constexpr float cell_size = 64.f;
+
+// Elements covering more than this fraction of all cells are always tested instead of being added to each cell.
+static constexpr int max_cell_coverage_divisor = 4;
+
+void HitTestGrid::Build(Element* root, Vector2i dimensions)
+{
+	RMLUI_ZoneScoped;
+
+	elements.clear();
+	unbounded_elements.clear();
+
+	num_cells_x = Math::Max(1, (int)std::ceil(float(dimensions.x) / cell_size));
+	num_cells_y = Math::Max(1, (int)std::ceil(float(dimensions.y) / cell_size));
+
+	// Keep the allocations of the cells around, they are usually rebuilt with similar contents.
+	cells.resize(size_t(num_cells_x * num_cells_y));
+	for (Vector<int>& cell : cells)
+		cell.clear();
+
+	AddElementRecursive(root);
+}
+
+void HitTestGrid::AddElementRecursive(Element* element)
+{
+	// Add the elements in the same order as they are tested by Context::GetElementAtPoint(), which searches the stacking context from
+	// the top before testing the element itself.
+	if (element->local_stacking_context)
+	{
+		if (element->stacking_context_dirty)
+			element->BuildLocalStackingContext();
+
+		for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
+			AddElementRecursive(element->stacking_context[i]);
+	}
+
+	if (element->GetComputedValues().pointer_events() == Style::PointerEvents::None)
+		return;
+
+	const int num_boxes = element->GetNumBoxes();
+	if (num_boxes == 0)
+		return;
+
+	const int index = (int)elements.size();
+	elements.push_back(element);
+
+	// The projection of transformed elements can place them anywhere on the screen.
+	const TransformState* transform_state = element->GetTransformState();
+	if (transform_state && transform_state->GetTransform())
+	{
+		unbounded_elements.push_back(index);
+		return;
+	}
+
+	const Vector2f position = element->GetAbsoluteOffset(Box::BORDER);
+	Vector2f min_corner = position;
+	Vector2f max_corner = position;
+
+	for (int i = 0; i < num_boxes; ++i)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(i, box_offset);
+		const Vector2f box_position = position + box_offset;
+		const Vector2f box_dimensions = box.GetSize(Box::BORDER);
+
+		if (i == 0)
+		{
+			min_corner = box_position;
+			max_corner = box_position + box_dimensions;
+		}
+		else
+		{
+			min_corner = Math::Min(min_corner, box_position);
+			max_corner = Math::Max(max_corner, box_position + box_dimensions);
+		}
+	}
+
+	if (!(min_corner.x <= max_corner.x && min_corner.y <= max_corner.y))
+	{
+		// Invalid bounds, such as from NaN values, let the element be tested exactly.
+		unbounded_elements.push_back(index);
+		return;
+	}
+
+	// Boxes are inclusive of their edges, and points outside the grid are clamped to the outer cells.
+	const int x_begin = Math::Clamp((int)std::floor(Math::Max(min_corner.x, -1.f) / cell_size), 0, num_cells_x - 1);
+	const int y_begin = Math::Clamp((int)std::floor(Math::Max(min_corner.y, -1.f) / cell_size), 0, num_cells_y - 1);
+	const int x_end = Math::Clamp((int)std::floor(Math::Min(max_corner.x, float(num_cells_x) * cell_size) / cell_size), 0, num_cells_x - 1) + 1;
+	const int y_end = Math::Clamp((int)std::floor(Math::Min(max_corner.y, float(num_cells_y) * cell_size) / cell_size), 0, num_cells_y - 1) + 1;
+
+	const int num_covered_cells = (x_end - x_begin) * (y_end - y_begin);
+	if (num_covered_cells > 1 && num_covered_cells > (num_cells_x * num_cells_y) / max_cell_coverage_divisor)
+	{
+		unbounded_elements.push_back(index);
+		return;
+	}
+
+	for (int y = y_begin; y < y_end; ++y)
+	{
+		for (int x = x_begin; x < x_end; ++x)
+			cells[size_t(y * num_cells_x + x)].push_back(index);
+	}
+}
+
+Element* HitTestGrid::GetElementAtPoint(Vector2f point, const Element* ignore_element) const
+{
+	if (cells.empty())
+		return nullptr;
+
+	const int x = Math::Clamp((int)std::floor(Math::Clamp(point.x / cell_size, -1.f, float(num_cells_x))), 0, num_cells_x - 1);
+	const int y = Math::Clamp((int)std::floor(Math::Clamp(point.y / cell_size, -1.f, float(num_cells_y))), 0, num_cells_y - 1);
+	const Vector<int>& cell = cells[size_t(y * num_cells_x + x)];
+
+	// Merge the cell with the unbounded elements, so that candidates are tested in order.
+	size_t i_cell = 0, i_unbounded = 0;
+	while (i_cell < cell.size() || i_unbounded < unbounded_elements.size())
+	{
+		int index = 0;
+		if (i_unbounded >= unbounded_elements.size() || (i_cell < cell.size() && cell[i_cell] < unbounded_elements[i_unbounded]))
+			index = cell[i_cell++];
+		else
+			index = unbounded_elements[i_unbounded++];
+
+		Element* element = elements[index];
+
+		if (ignore_element)
+		{
+			const Element* element_hierarchy = element;
+			while (element_hierarchy != nullptr && element_hierarchy != ignore_element)
+				element_hierarchy = element_hierarchy->GetParentNode();
+
+			if (element_hierarchy != nullptr)
+				continue;
+		}
+
+		if (IsElementHit(element, point))
+			return element;
+	}
+
+	return nullptr;
+}
+
+bool HitTestGrid::IsElementHit(Element* element, Vector2f point)
+{
+	// Ignore elements whose pointer events are disabled.
+	if (element->GetComputedValues().pointer_events() == Style::PointerEvents::None)
+		return false;
+
+	// Projection may fail if we have a singular transformation matrix.
+	bool projection_result = element->Project(point);
+
+	// Check if the point is actually within this element.
+	bool within_element = (projection_result && element->IsPointWithinElement(point));
+	if (within_element)
+	{
+		Vector2i clip_origin, clip_dimensions;
+		if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, element))
+		{
+			within_element = point.x >= clip_origin.x &&
+							 point.y >= clip_origin.y &&
+							 point.x <= (clip_origin.x + clip_dimensions.x) &&
+							 point.y <= (clip_origin.y + clip_dimensions.y);
+		}
+	}
+
+	return within_element;
+}
+
+} // namespace Rml
@@ -0,0 +1,78 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A uniform grid over the border boxes of all elements in a context, used to accelerate hit testing.
+
+	Elements are stored in the order they are tested by Context::GetElementAtPoint(), that is, by descending stacking order. Each cell
+	lists the elements whose boxes overlap it, and a hit test only needs to consider the elements of a single cell. Transformed
+	elements, and elements covering a large part of the grid, are instead stored in a separate list which is always considered. The
+	candidates are tested exactly like the recursive search, thus the grid only needs to be conservative.
+
+	The grid refers to elements by pointer, so it must be rebuilt after any change to the geometry or the element tree.
+ */
+class HitTestGrid {
+public:
+	/// Builds the grid from the stacking contexts of the given root element.
+	/// @param[in] root The root element of the context.
+	/// @param[in] dimensions The dimensions of the context.
+	void Build(Element* root, Vector2i dimensions);
+
+	/// Returns the element under the given point, or nullptr if nothing is.
+	/// @param[in] point The point in screen coordinates.
+	/// @param[in] ignore_element If set, this element and its descendants will be ignored.
+	Element* GetElementAtPoint(Vector2f point, const Element* ignore_element) const;
+
+	/// Returns true if the point hits the given element itself, ignoring its descendants.
+	static bool IsElementHit(Element* element, Vector2f point);
+
+private:
+	void AddElementRecursive(Element* element);
+
+	// All hit-testable elements in the order they are tested.
+	Vector<Element*> elements;
+
+	// Indices into 'elements' for each cell, and for elements that are always tested, in ascending order.
+	Vector<Vector<int>> cells;
+	Vector<int> unbounded_elements;
+
+	int num_cells_x = 0;
+	int num_cells_y = 0;
+};
+
+} // namespace Rml
+#endif
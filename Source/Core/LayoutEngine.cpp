@@ -57,6 +57,8 @@ static Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true);
 static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
 static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
 
+static int num_formatted_elements = 0;
+
 static inline bool ValidateTopLevelElement(Element* element)
 {
 	const Style::Display display = element->GetDisplay();
@@ -96,6 +98,8 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 
 	if (!ValidateTopLevelElement(element))
 		return;
+
+	num_formatted_elements += 1;
 	
 	auto containing_block_box = MakeUnique<LayoutBlockBox>(nullptr, nullptr, Box(containing_block), 0.0f, FLT_MAX);
 
@@ -130,6 +134,69 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 	element->OnLayout();
 }
 
+bool LayoutEngine::IsLayoutBoundary(Element* element)
+{
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+
+	// Only elements formatted in their own block formatting context are considered, and with their position not depending on their siblings.
+	// Inline-blocks are not considered as their baseline depends on their contents.
+	if (computed.display() != Display::Block)
+		return false;
+	if (computed.position() != Position::Absolute && computed.position() != Position::Fixed && computed.float_() == Float::None)
+		return false;
+
+	// The element must be positioned so that it acts as the containing block of any absolutely positioned descendants, otherwise they are
+	// formatted relative to an element outside the boundary. This excludes floats with static positioning.
+	if (computed.position() == Position::Static)
+		return false;
+
+	// The size must be fixed, and any overflow must be caught by the element itself, so that the contents can't affect its surroundings.
+	// Percentage sizes are not considered fixed, as they are resolved against a containing block which is not formatted with the boundary.
+	if (computed.width().type != Width::Length || computed.height().type != Height::Length)
+		return false;
+	if (computed.overflow_x() == Overflow::Visible || computed.overflow_y() == Overflow::Visible)
+		return false;
+
+	return true;
+}
+
+void LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(IsLayoutBoundary(element));
+
+	// Find the containing block the element was formatted within, see 'LayoutBlockBox::CloseAbsoluteElements()' and 'FormatElement()' for
+	// absolutely positioned and floating elements, respectively. The element's box is fixed and reused, thus it is only used for resolving
+	// relative min- and max-sizes.
+	Vector2f containing_block;
+	const Style::Position position = element->GetComputedValues().position();
+	if (position == Style::Position::Absolute || position == Style::Position::Fixed)
+	{
+		if (Element* offset_parent = element->GetOffsetParent())
+			containing_block = offset_parent->GetBox().GetSize(Box::PADDING);
+	}
+	else if (Element* parent = element->GetParentNode())
+	{
+		containing_block = parent->GetBox().GetSize(Box::CONTENT);
+	}
+
+	containing_block.x = Math::Max(containing_block.x, 0.f);
+	containing_block.y = Math::Max(containing_block.y, 0.f);
+
+	const Box box = element->GetBox();
+	FormatElement(element, containing_block, &box);
+}
+
+int LayoutEngine::GetNumFormattedElements()
+{
+	return num_formatted_elements;
+}
+
+void LayoutEngine::ResetNumFormattedElements()
+{
+	num_formatted_elements = 0;
+}
+
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
 	static_assert(ChunkSizeBig > ChunkSizeMedium && ChunkSizeMedium > ChunkSizeSmall, "The following assumes a strict ordering of the chunk sizes.");
@@ -253,6 +320,8 @@ bool LayoutEngine::FormatElementBlock(LayoutBlockBox* block_context_box, Element
 {
 	RMLUI_ZoneScopedC(0x2F4F4F);
 
+	num_formatted_elements += 1;
+
 	Box box;
 	float min_height, max_height;
 	LayoutDetails::BuildBox(box, min_height, max_height, block_context_box, element);
@@ -299,6 +368,8 @@ bool LayoutEngine::FormatElementInline(LayoutBlockBox* block_context_box, Elemen
 {
 	RMLUI_ZoneScopedC(0x3F6F6F);
 
+	num_formatted_elements += 1;
+
 	const Vector2f containing_block = LayoutDetails::GetContainingBlock(block_context_box);
 
 	Box box;
@@ -334,6 +405,8 @@ bool LayoutEngine::FormatElementInlineBlock(LayoutBlockBox* block_context_box, E
 
 bool LayoutEngine::FormatElementFlex(LayoutBlockBox* block_context_box, Element* element)
 {
+	num_formatted_elements += 1;
+
 	const ComputedValues& computed = element->GetComputedValues();
 	const Vector2f containing_block = LayoutDetails::GetContainingBlock(block_context_box);
 	RMLUI_ASSERT(containing_block.x >= 0.f);
@@ -396,6 +469,8 @@ bool LayoutEngine::FormatElementFlex(LayoutBlockBox* block_context_box, Element*
 
 bool LayoutEngine::FormatElementTable(LayoutBlockBox* block_context_box, Element* element_table)
 {
+	num_formatted_elements += 1;
+
 	const ComputedValues& computed_table = element_table->GetComputedValues();
 
 	const Vector2f containing_block = LayoutDetails::GetContainingBlock(block_context_box);
@@ -56,6 +56,19 @@ public:
 	/// @param[in] element The element to lay out.
 	static bool FormatElement(LayoutBlockBox* block_context_box, Element* element);
 
+	/// Returns true if the element is a layout boundary. The box of a layout boundary does not depend on its contents, and its contents do not
+	/// affect the layout of the rest of the document. Thus, changes to its contents only require reformatting the contents of the boundary.
+	/// @param[in] element The element to check.
+	static bool IsLayoutBoundary(Element* element);
+	/// Reformats the contents of a layout boundary, keeping its current box and position.
+	/// @param[in] element The layout boundary to format, must have been formatted previously as part of its document.
+	static void FormatLayoutBoundary(Element* element);
+
+	/// Returns the number of elements formatted since the counter was last reset.
+	static int GetNumFormattedElements();
+	/// Resets the counter of formatted elements.
+	static void ResetNumFormattedElements();
+
 	static void* AllocateLayoutChunk(size_t size);
 	static void DeallocateLayoutChunk(void* chunk, size_t size);
 
@@ -284,5 +284,11 @@ Colourb RoundedLerp(float t, Colourb v0, Colourb v1)
 	};
 }
 
+Colourb MultiplyColour(Colourb c0, Colourb c1)
+{
+	auto multiply = [](byte a, byte b) { return static_cast<byte>((int(a) * int(b) + 127) / 255); };
+	return Colourb{multiply(c0.red, c1.red), multiply(c0.green, c1.green), multiply(c0.blue, c1.blue), multiply(c0.alpha, c1.alpha)};
+}
+
 }
 } // namespace Rml
@@ -0,0 +1,197 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RenderCommandList.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+
+namespace Rml {
+
+void RenderCommandList::Clear()
+{
+	commands.clear();
+	vertices.clear();
+	indices.clear();
+	transforms.clear();
+
+	scissor_dirty = false;
+	recorded_scissor_valid = false;
+	transform_dirty = false;
+	recorded_transform_valid = false;
+
+	num_geometries = 0;
+	num_batches = 0;
+}
+
+void RenderCommandList::AddGeometry(const Vertex* in_vertices, int num_vertices, const int* in_indices, int num_indices, TextureHandle texture,
+	Vector2f translation, Colourb colour_multiplier)
+{
+	if (num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	FlushState();
+	num_geometries += 1;
+
+	const int vertex_offset = (int)vertices.size();
+
+	// Merge with the previous geometry if there are no state changes in-between.
+	if (commands.empty() || commands.back().type != CommandType::Geometry || commands.back().texture != texture)
+	{
+		Command command;
+		command.type = CommandType::Geometry;
+		command.texture = texture;
+		command.vertex_begin = vertex_offset;
+		command.index_begin = (int)indices.size();
+		commands.push_back(command);
+		num_batches += 1;
+	}
+
+	Command& batch = commands.back();
+	const int index_offset = vertex_offset - batch.vertex_begin;
+
+	vertices.insert(vertices.end(), in_vertices, in_vertices + num_vertices);
+	for (int i = vertex_offset; i < (int)vertices.size(); i++)
+		vertices[i].position += translation;
+
+	if (colour_multiplier != Colourb(255))
+	{
+		for (int i = vertex_offset; i < (int)vertices.size(); i++)
+			vertices[i].colour = Math::MultiplyColour(vertices[i].colour, colour_multiplier);
+	}
+
+	indices.reserve(indices.size() + num_indices);
+	for (int i = 0; i < num_indices; i++)
+		indices.push_back(in_indices[i] + index_offset);
+
+	batch.num_vertices += num_vertices;
+	batch.num_indices += num_indices;
+}
+
+void RenderCommandList::SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions)
+{
+	scissor.enabled = enable;
+	scissor.origin = (enable ? origin : Vector2i(0, 0));
+	scissor.dimensions = (enable ? dimensions : Vector2i(0, 0));
+	scissor_dirty = true;
+}
+
+void RenderCommandList::SetTransform(const Matrix4f* in_transform)
+{
+	transform.enabled = (in_transform != nullptr);
+	if (in_transform)
+		transform.matrix = *in_transform;
+	transform_dirty = true;
+}
+
+void RenderCommandList::FlushState()
+{
+	if (scissor_dirty)
+	{
+		scissor_dirty = false;
+
+		const bool changed = !recorded_scissor_valid || scissor.enabled != recorded_scissor.enabled ||
+			(scissor.enabled && (scissor.origin != recorded_scissor.origin || scissor.dimensions != recorded_scissor.dimensions));
+
+		if (changed)
+		{
+			Command command;
+			command.type = CommandType::Scissor;
+			command.scissor_enabled = scissor.enabled;
+			command.scissor_origin = scissor.origin;
+			command.scissor_dimensions = scissor.dimensions;
+			commands.push_back(command);
+
+			recorded_scissor = scissor;
+			recorded_scissor_valid = true;
+		}
+	}
+
+	if (transform_dirty)
+	{
+		transform_dirty = false;
+
+		const bool changed = !recorded_transform_valid || transform.enabled != recorded_transform.enabled ||
+			(transform.enabled && transform.matrix != recorded_transform.matrix);
+
+		if (changed)
+		{
+			Command command;
+			command.type = CommandType::Transform;
+			if (transform.enabled)
+			{
+				command.transform_index = (int)transforms.size();
+				transforms.push_back(transform.matrix);
+			}
+			commands.push_back(command);
+
+			recorded_transform = transform;
+			recorded_transform_valid = true;
+		}
+	}
+}
+
+void RenderCommandList::Submit(RenderInterface* render_interface)
+{
+	RMLUI_ZoneScoped;
+
+	// Make sure the render interface ends up in the final state, even if no geometry follows the last state changes.
+	FlushState();
+
+	for (const Command& command : commands)
+	{
+		switch (command.type)
+		{
+		case CommandType::Geometry:
+			render_interface->RenderBatchedGeometry(vertices.data() + command.vertex_begin, command.num_vertices, indices.data() + command.index_begin,
+				command.num_indices, command.texture);
+			break;
+		case CommandType::Scissor:
+			render_interface->EnableScissorRegion(command.scissor_enabled);
+			if (command.scissor_enabled)
+				render_interface->SetScissorRegion(command.scissor_origin.x, command.scissor_origin.y, command.scissor_dimensions.x,
+					command.scissor_dimensions.y);
+			break;
+		case CommandType::Transform:
+			render_interface->SetTransform(command.transform_index < 0 ? nullptr : &transforms[command.transform_index]);
+			break;
+		}
+	}
+}
+
+int RenderCommandList::GetNumGeometries() const
+{
+	return num_geometries;
+}
+
+int RenderCommandList::GetNumBatches() const
+{
+	return num_batches;
+}
+
+} // namespace Rml
@@ -0,0 +1,114 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RENDERCOMMANDLIST_H
+#define RMLUI_CORE_RENDERCOMMANDLIST_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+class RenderInterface;
+
+/**
+	A flat list of render commands recorded during a context render, used for render batching.
+
+	Consecutive geometry sharing the same texture, transform, and scissor state is merged into a single batch while recording. State
+	changes are only recorded once geometry is added, so that redundant changes between batches are dropped. The commands are then
+	submitted to the render interface in order.
+ */
+class RenderCommandList {
+public:
+	/// Removes all recorded commands, keeping the allocated buffers for the next frame.
+	void Clear();
+
+	/// Records geometry to be rendered with the current state.
+	void AddGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, Vector2f translation,
+		Colourb colour_multiplier = Colourb(255));
+	/// Records a change to the scissor region.
+	void SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions);
+	/// Records a change to the transform, nullptr for no transform. The matrix is copied.
+	void SetTransform(const Matrix4f* transform);
+
+	/// Submits all the recorded commands to the render interface.
+	void Submit(RenderInterface* render_interface);
+
+	/// Returns the number of geometries recorded since the last clear.
+	int GetNumGeometries() const;
+	/// Returns the number of batches the recorded geometries were merged into.
+	int GetNumBatches() const;
+
+private:
+	enum class CommandType : uint8_t { Geometry, Scissor, Transform };
+
+	struct Command {
+		CommandType type = CommandType::Geometry;
+
+		// Geometry, ranges into the vertex and index buffers.
+		TextureHandle texture = 0;
+		int vertex_begin = 0, num_vertices = 0;
+		int index_begin = 0, num_indices = 0;
+
+		// Scissor.
+		bool scissor_enabled = false;
+		Vector2i scissor_origin, scissor_dimensions;
+
+		// Transform, index into the transform buffer, or -1 for no transform.
+		int transform_index = -1;
+	};
+
+	struct ScissorState {
+		bool enabled = false;
+		Vector2i origin, dimensions;
+	};
+	struct TransformState {
+		bool enabled = false;
+		Matrix4f matrix;
+	};
+
+	// Records any state changes made since the last recorded geometry.
+	void FlushState();
+
+	Vector<Command> commands;
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<Matrix4f> transforms;
+
+	ScissorState scissor, recorded_scissor;
+	bool scissor_dirty = false, recorded_scissor_valid = false;
+
+	TransformState transform, recorded_transform;
+	bool transform_dirty = false, recorded_transform_valid = false;
+
+	int num_geometries = 0;
+	int num_batches = 0;
+};
+
+} // namespace Rml
+#endif
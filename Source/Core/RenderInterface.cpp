@@ -57,6 +57,24 @@ void RenderInterface::RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/
 {
 }
 
+// Called by RmlUi to query whether the render interface can render compiled geometry with a colour multiplier.
+bool RenderInterface::SupportsColourMultiplier()
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to render application-compiled geometry with a colour multiplier.
+void RenderInterface::RenderCompiledGeometryWithColour(CompiledGeometryHandle geometry, const Vector2f& translation, const Colourb& /*colour_multiplier*/)
+{
+	RenderCompiledGeometry(geometry, translation);
+}
+
+// Called by RmlUi when it wants to render a batch of geometry merged from multiple draw calls.
+void RenderInterface::RenderBatchedGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture)
+{
+	RenderGeometry(vertices, num_vertices, indices, num_indices, texture, Vector2f(0, 0));
+}
+
 // Called by RmlUi when it wants to release application-compiled geometry.
 void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/)
 {
@@ -74,6 +92,31 @@ bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const b
 	return false;
 }
 
+// Called by RmlUi to query whether the render interface can update regions of generated textures.
+bool RenderInterface::SupportsTextureUpdates()
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to update a region of a generated texture.
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const Vector2i& /*region_offset*/, const Vector2i& /*region_dimensions*/,
+	const byte* /*source*/, int /*source_stride*/)
+{
+	return false;
+}
+
+// Called by RmlUi to query whether the render interface can render distance field textures.
+bool RenderInterface::SupportsDistanceFieldTextures()
+{
+	return false;
+}
+
+// Called by RmlUi when a distance field texture is required.
+bool RenderInterface::GenerateDistanceFieldTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
@@ -36,13 +36,28 @@
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
+#include <mutex>
 
 namespace Rml {
 
+// The element definition cache is split into several independently locked shards, to reduce contention when element definitions are resolved from
+// multiple threads simultaneously.
+struct ElementDefinitionCache {
+	static constexpr size_t num_shards = 16;
+
+	struct Shard {
+		std::mutex mutex;
+		UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>> definitions;
+	};
+
+	Shard shards[num_shards];
+};
+
 StyleSheet::StyleSheet()
 {
 	root = MakeUnique<StyleSheetNode>();
 	specificity_offset = 0;
+	node_cache = MakeUnique<ElementDefinitionCache>();
 }
 
 StyleSheet::~StyleSheet()
@@ -198,14 +213,17 @@ const Sprite* StyleSheet::GetSprite(const String& name) const
 // Returns the compiled element definition for a given element hierarchy.
 SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
 {
-	RMLUI_ASSERT_NONRECURSIVE;
-
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector< const StyleSheetNode* > applicable_nodes;
+	// Using a thread-local buffer to avoid allocations, while allowing definitions to be resolved from multiple threads.
+	static thread_local Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	// The ancestor filter can only be used when it represents the ancestors of this particular element, such as during the element update loop.
+	const AncestorFilter* ancestor_filter = &AncestorFilter::Get();
+	if (!ancestor_filter->IsValidFor(element))
+		ancestor_filter = nullptr;
+
+	auto AddApplicableNodes = [element, ancestor_filter](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(std::size_t(key));
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
@@ -215,26 +233,27 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
 				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
 				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
+				if (node->IsApplicable(element, ancestor_filter))
 					applicable_nodes.push_back(node);
 			}
 		}
 	};
 
 	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
+	const ElementStyle* style = element->GetStyle();
+	const Atom tag = style->GetTagAtom();
+	const Atom id = style->GetIdAtom();
 
 	// Text elements are never matched.
-	if (tag == "#text")
+	static const Atom text_tag = MakeAtom("#text");
+	if (tag == text_tag)
 		return nullptr;
 
 	// First, look up the indexed requirements. 
-	if (!id.empty())
+	if (id != Atom::Invalid)
 		AddApplicableNodes(styled_node_index.ids, id);
 
-	for (const String& name : class_names)
+	for (Atom name : style->GetClassAtoms())
 		AddApplicableNodes(styled_node_index.classes, name);
 
 	AddApplicableNodes(styled_node_index.tags, tag);
@@ -242,7 +261,7 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
 	{
-		if (node->IsApplicable(element))
+		if (node->IsApplicable(element, ancestor_filter))
 			applicable_nodes.push_back(node);
 	}
 
@@ -260,7 +279,12 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	});
 
 	// Check if this puppy has already been cached in the node index.
-	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
+	const size_t hash = std::hash<StyleSheetIndex::NodeList>()(applicable_nodes);
+	ElementDefinitionCache::Shard& shard = node_cache->shards[hash % ElementDefinitionCache::num_shards];
+
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	SharedPtr<const ElementDefinition>& definition = shard.definitions[applicable_nodes];
 	if (!definition)
 	{
 		// Otherwise, create a new definition and add it to our cache.
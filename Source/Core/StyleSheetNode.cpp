@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -50,11 +51,13 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -131,8 +134,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[std::size_t(key)];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -140,7 +143,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id != Atom::Invalid)
 		{
 			IndexInsertNode(styled_node_index.ids, selector.id, this);
 		}
@@ -150,7 +153,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
 			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
 		}
-		else if (!selector.tag.empty())
+		else if (selector.tag != Atom::Invalid)
 		{
 			IndexInsertNode(styled_node_index.tags, selector.tag, this);
 		}
@@ -185,21 +188,23 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (selector.tag != Atom::Invalid && selector.tag != style->GetTagAtom())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Invalid && selector.id != style->GetIdAtom())
 		return false;
 
-	for (auto& name : selector.class_names)
+	for (Atom name : selector.class_names)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	for (auto& name : selector.pseudo_class_names)
+	for (Atom name : selector.pseudo_class_names)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
@@ -345,29 +350,31 @@ bool StyleSheetNode::TraverseMatch(const Element* element) const
 	return false;
 }
 
-bool StyleSheetNode::IsApplicable(const Element* element) const
+bool StyleSheetNode::IsApplicable(const Element* element, const AncestorFilter* ancestor_filter) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of the element's document will be
 	// considered during the match as necessary.
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
+	const ElementStyle* style = element->GetStyle();
+
+	for (Atom name : selector.pseudo_class_names)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (selector.tag != Atom::Invalid && selector.tag != style->GetTagAtom())
 		return false;
 
-	for (const String& name : selector.class_names)
+	for (Atom name : selector.class_names)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Invalid && selector.id != style->GetIdAtom())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
@@ -377,22 +384,47 @@ bool StyleSheetNode::IsApplicable(const Element* element) const
 	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element))
 		return false;
 
-	// Walk up through all our parent nodes, each one of them must be matched by some ancestor or sibling element.
-	if (parent && !TraverseMatch(element))
-		return false;
+	if (parent)
+	{
+		// Reject the node early if any names required by our parent nodes are missing from the element's ancestors.
+		if (ancestor_filter && !ancestor_filter->MayContainAll(ancestor_hashes))
+		{
+			AncestorFilter::CountRejectedNode();
+			return false;
+		}
+
+		if (ancestor_filter)
+			AncestorFilter::CountTraversedNode();
+
+		// Walk up through all our parent nodes, each one of them must be matched by some ancestor or sibling element.
+		if (!TraverseMatch(element))
+			return false;
+	}
 
 	return true;
 }
 
+void StyleSheetNode::CalculateAncestorHashes()
+{
+	if (!parent)
+		return;
+
+	// A parent node linked with a descendant or child combinator must match an ancestor of the element. Any requirements further up the tree must
+	// also be matched by ancestors, as the ancestors of an element's siblings are the same as the element's own.
+	ancestor_hashes = parent->ancestor_hashes;
+	if (selector.combinator == SelectorCombinator::Descendant || selector.combinator == SelectorCombinator::Child)
+		AncestorFilter::AddHashes(ancestor_hashes, parent->selector.tag, parent->selector.id, parent->selector.class_names);
+}
+
 void StyleSheetNode::CalculateAndSetSpecificity()
 {
 	// First calculate the specificity of this node alone.
 	specificity = 0;
 
-	if (!selector.tag.empty())
+	if (selector.tag != Atom::Invalid)
 		specificity += SelectorSpecificity::Tag;
 
-	if (!selector.id.empty())
+	if (selector.id != Atom::Invalid)
 		specificity += SelectorSpecificity::ID;
 
 	specificity += SelectorSpecificity::Class * (int)selector.class_names.size();
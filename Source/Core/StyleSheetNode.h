@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
@@ -72,15 +73,18 @@ public:
 	const PropertyDictionary& GetProperties() const;
 
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
+	/// @param[in] element The element to match.
+	/// @param[in] ancestor_filter If set, must represent the ancestors of the element. Used to reject the node before walking up the hierarchy.
 	/// @note For performance reasons this call does not check whether 'element' is a text element. The caller must manually check this condition and
 	/// consider any text element not applicable.
-	bool IsApplicable(const Element* element) const;
+	bool IsApplicable(const Element* element, const AncestorFilter* ancestor_filter = nullptr) const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -99,6 +103,9 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// Hashes of the names which must be present in the ancestors of any matching element, for use with the ancestor filter.
+	AncestorHashList ancestor_hashes;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
@@ -946,8 +946,8 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 
 				switch (rule[start_index])
 				{
-				case '#': selector.id = String(p_begin + 1, p_end); break;
-				case '.': selector.class_names.push_back(String(p_begin + 1, p_end)); break;
+				case '#': selector.id = MakeAtom(String(p_begin + 1, p_end)); break;
+				case '.': selector.class_names.push_back(MakeAtom(String(p_begin + 1, p_end))); break;
 				case ':':
 				{
 					String pseudo_class_name = String(p_begin + 1, p_end);
@@ -955,7 +955,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					if (node_selector.type != StructuralSelectorType::Invalid)
 						selector.structural_selectors.push_back(node_selector);
 					else
-						selector.pseudo_class_names.push_back(std::move(pseudo_class_name));
+						selector.pseudo_class_names.push_back(MakeAtom(pseudo_class_name));
 				}
 				break;
 				case '[':
@@ -993,7 +993,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					selector.attributes.push_back(std::move(attribute));
 				}
 				break;
-				default: selector.tag = String(p_begin, p_end); break;
+				default: selector.tag = MakeAtom(String(p_begin, p_end)); break;
 				}
 			}
 
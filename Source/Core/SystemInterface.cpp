@@ -141,4 +141,15 @@ void SystemInterface::ActivateKeyboard(Rml::Vector2f /*caret_position*/, float /
 
 void SystemInterface::DeactivateKeyboard() {}
 
+int SystemInterface::GetNumWorkerThreads()
+{
+	return 0;
+}
+
+void SystemInterface::RunParallelTasks(int num_tasks, const Function<void(int)>& task)
+{
+	for (int i = 0; i < num_tasks; i++)
+		task(i);
+}
+
 } // namespace Rml
@@ -38,10 +38,16 @@ void Texture::Set(const String& source, const String& source_path)
 	resource = TextureDatabase::Fetch(source, source_path);
 }
 
-void Texture::Set(const String& name, const TextureCallback& callback)
+void Texture::Set(const String& name, const TextureCallback& callback, bool distance_field)
 {
 	resource = MakeShared<TextureResource>();
-	resource->Set(name, callback);
+	resource->Set(name, callback, distance_field);
+}
+
+void Texture::Update(Vector2i region_offset, Vector2i region_dimensions, const byte* source, int source_stride)
+{
+	if (resource)
+		resource->Update(region_offset, region_dimensions, source, source_stride);
 }
 
 // Returns the texture's source name. This is usually the name of the file the texture was loaded from.
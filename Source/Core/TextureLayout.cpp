@@ -85,25 +85,85 @@ int TextureLayout::GetNumTextures() const
 	return (int) textures.size();
 }
 
-// Attempts to generate an efficient texture layout for the rectangles.
+// Places the rectangles added since the previous call.
 bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 {
-	// Sort the rectangles by height.
-	std::sort(rectangles.begin(), rectangles.end(), RectangleSort());
+	first_new_rectangle = num_generated_rectangles;
+	num_generated_rectangles = GetNumRectangles();
 
-	int num_placed_rectangles = 0;
-	while (num_placed_rectangles != GetNumRectangles())
-	{
-		TextureLayoutTexture texture;
-		int texture_size = texture.Generate(*this, max_texture_dimensions);
-		if (texture_size == 0)
-			return false;
+	// Sort the new rectangles by height, previously placed rectangles must keep their index.
+	std::sort(rectangles.begin() + first_new_rectangle, rectangles.end(), RectangleSort());
+
+	bool success = true;
 
-		textures.push_back(texture);
-		num_placed_rectangles += texture_size;
+	for (int i = first_new_rectangle; i < GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = rectangles[i];
+
+		// Try the remaining space in the existing textures first, newest textures are most likely to have room.
+		for (int texture_index = GetNumTextures() - 1; texture_index >= 0; --texture_index)
+		{
+			if (textures[texture_index].Place(rectangle, texture_index))
+				break;
+		}
+
+		if (!rectangle.IsPlaced())
+		{
+			// Come up with an estimate for how big a texture we need. Calculate the total square pixels required by the remaining
+			// rectangles to place, and leave equally much room for rectangles added later. Square-root it to get the dimensions of
+			// the smallest texture necessary (under optimal circumstances) and round it up to the nearest power of two.
+			int square_pixels = 0;
+			Vector2i max_dimensions(0, 0);
+			for (int j = i; j < GetNumRectangles(); ++j)
+			{
+				const Vector2i dimensions = rectangles[j].GetDimensions() + Vector2i(1);
+				square_pixels += dimensions.x * dimensions.y;
+				max_dimensions.x = Math::Max(max_dimensions.x, dimensions.x);
+				max_dimensions.y = Math::Max(max_dimensions.y, dimensions.y);
+			}
+
+			Vector2i texture_dimensions;
+			texture_dimensions.y = Math::ToPowerOfTwo(Math::RealToInteger(Math::SquareRoot(2.f * (float)square_pixels)));
+			texture_dimensions.x = texture_dimensions.y >> 1;
+
+			// Make sure the largest rectangle fits, and don't make textures smaller than the previous ones.
+			texture_dimensions.x = Math::Max(texture_dimensions.x, Math::ToPowerOfTwo(max_dimensions.x + 1));
+			texture_dimensions.y = Math::Max(texture_dimensions.y, Math::ToPowerOfTwo(max_dimensions.y + 1));
+			if (!textures.empty())
+			{
+				texture_dimensions.x = Math::Max(texture_dimensions.x, textures.back().GetDimensions().x);
+				texture_dimensions.y = Math::Max(texture_dimensions.y, textures.back().GetDimensions().y);
+			}
+
+			texture_dimensions.x = Math::Min(texture_dimensions.x, max_texture_dimensions);
+			texture_dimensions.y = Math::Min(texture_dimensions.y, max_texture_dimensions);
+
+			textures.emplace_back(texture_dimensions);
+			if (!textures.back().Place(rectangle, GetNumTextures() - 1))
+			{
+				// The rectangle is too large for any texture.
+				textures.pop_back();
+				success = false;
+				continue;
+			}
+		}
 	}
 
-	return true;
+	return success;
+}
+
+// Returns the index of the first rectangle placed during the last call to GenerateLayout().
+int TextureLayout::GetFirstNewRectangle() const
+{
+	return first_new_rectangle;
+}
+
+void TextureLayout::Clear()
+{
+	textures.clear();
+	rectangles.clear();
+	first_new_rectangle = 0;
+	num_generated_rectangles = 0;
 }
 
 } // namespace Rml
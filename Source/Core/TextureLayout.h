@@ -38,6 +38,10 @@ namespace Rml {
 	A texture layout generates and stores a layout of rectangles within a series of textures. It is
 	used primarily by the font system for generating font textures.
 
+	The layout is incremental: rectangles can be added after the layout has been generated, these are
+	placed into the remaining space of the existing textures, or new textures when they are full.
+	Previously placed rectangles never move.
+
 	@author Peter
  */
 
@@ -47,8 +51,8 @@ public:
 	TextureLayout();
 	~TextureLayout();
 
-	/// Adds a rectangle to the list of rectangles to be laid out. All rectangles must be added to
-	/// the layout before the layout is generated.
+	/// Adds a rectangle to the list of rectangles to be laid out. The rectangle is placed during the
+	/// next call to GenerateLayout().
 	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
 	/// @param[in] dimensions The dimensions of the rectangle.
 	void AddRectangle(int id, Vector2i dimensions);
@@ -69,10 +73,15 @@ public:
 	/// @return The layout's texture count.
 	int GetNumTextures() const;
 
-	/// Attempts to generate an efficient texture layout for the rectangles.
+	/// Places the rectangles added since the previous call, without moving any previously placed rectangles.
 	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
-	/// @return True if the layout was generated successfully, false if not.
+	/// @return True if all the new rectangles were placed, false if any of them did not fit into a texture.
 	bool GenerateLayout(int max_texture_dimensions);
+	/// Returns the index of the first rectangle placed during the last call to GenerateLayout().
+	int GetFirstNewRectangle() const;
+
+	/// Removes all rectangles and textures from the layout.
+	void Clear();
 
 private:
 	using RectangleList = Vector< TextureLayoutRectangle >;
@@ -80,6 +89,8 @@ private:
 
 	TextureList textures;
 	RectangleList rectangles;
+	int first_new_rectangle = 0;
+	int num_generated_rectangles = 0;
 };
 
 } // namespace Rml
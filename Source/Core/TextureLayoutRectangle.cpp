@@ -34,9 +34,6 @@ TextureLayoutRectangle::TextureLayoutRectangle(const int _id, const Vector2i dim
 {
 	id = _id;
 	texture_index = -1;
-
-	texture_data = nullptr;
-	texture_stride = 0;
 }
 
 TextureLayoutRectangle::~TextureLayoutRectangle()
@@ -68,41 +65,16 @@ void TextureLayoutRectangle::Place(const int _texture_index, const Vector2i posi
 	texture_position = position;
 }
 
-// Unplaces the rectangle.
-void TextureLayoutRectangle::Unplace()
-{
-	texture_index = -1;
-}
-
 // Returns the rectangle's placed state.
 bool TextureLayoutRectangle::IsPlaced() const
 {
 	return texture_index > -1;
 }
 
-// Sets the rectangle's texture data and stride.
-void TextureLayoutRectangle::Allocate(byte* _texture_data, int _texture_stride)
-{
-	texture_data = _texture_data + ((texture_position.y * _texture_stride) + texture_position.x * 4);
-	texture_stride = _texture_stride;
-}
-
 // Returns the index of the texture this rectangle is placed on.
 int TextureLayoutRectangle::GetTextureIndex()
 {
 	return texture_index;
 }
 
-// Returns the rectangle's allocated texture data.
-byte* TextureLayoutRectangle::GetTextureData()
-{
-	return texture_data;
-}
-
-// Returns the stride of the rectangle's texture data.
-int TextureLayoutRectangle::GetTextureStride() const
-{
-	return texture_stride;
-}
-
 } // namespace Rml
@@ -59,26 +59,13 @@ public:
 	/// @param[in] texture_index The index of the texture this rectangle is placed on.
 	/// @param[in] position The position within the texture of this rectangle's top-left corner.
 	void Place(int texture_index, Vector2i position);
-	/// Unplaces the rectangle.
-	void Unplace();
 	/// Returns the rectangle's placed state.
 	/// @return True if the rectangle has been placed, false if not.
 	bool IsPlaced() const;
 
-	/// Sets the rectangle's texture data and stride.
-	/// @param[in] texture_data The pointer to the top-left corner of the texture's data.
-	/// @param[in] texture_stride The stride of the texture data, in bytes.
-	void Allocate(byte* texture_data, int texture_stride);
-
 	/// Returns the index of the texture this rectangle is placed on.
 	/// @return The texture index.
 	int GetTextureIndex();
-	/// Returns the rectangle's allocated texture data.
-	/// @return The texture data.
-	byte* GetTextureData();
-	/// Returns the stride of the rectangle's texture data.
-	/// @return The texture data stride.
-	int GetTextureStride() const;
 
 private:
 	int id;
@@ -86,9 +73,6 @@ private:
 
 	int texture_index;
 	Vector2i texture_position;
-
-	byte* texture_data;
-	int texture_stride;
 };
 
 } // namespace Rml
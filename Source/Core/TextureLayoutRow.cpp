@@ -27,69 +27,36 @@
  */
 
 #include "TextureLayoutRow.h"
-#include "TextureLayout.h"
 
 namespace Rml {
 
-TextureLayoutRow::TextureLayoutRow()
-{
-	height = 0;
-}
+TextureLayoutRow::TextureLayoutRow(int y, int height) : y(y), height(height), width(1)
+{}
 
 TextureLayoutRow::~TextureLayoutRow()
-{
-}
+{}
 
-// Attempts to position unplaced rectangles from the layout into this row.
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+// Attempts to position a rectangle at the end of this row.
+bool TextureLayoutRow::Place(TextureLayoutRectangle& rectangle, int texture_index, int max_width)
 {
-	int width = 1;
-	int first_unplaced_index = 0;
-	int placed_rectangles = 0;
-
-	while (width < max_width)
-	{
-		// Find the first unplaced rectangle we can fit.
-		int index;
-		for (index = first_unplaced_index; index < layout.GetNumRectangles(); ++index)
-		{
-			TextureLayoutRectangle& rectangle = layout.GetRectangle(index);
-			if (!rectangle.IsPlaced())
-			{
-				if (width + rectangle.GetDimensions().x + 1 <= max_width)
-					break;
-			}
-		}
-
-		if (index == layout.GetNumRectangles())
-			return placed_rectangles;
+	const Vector2i dimensions = rectangle.GetDimensions();
+	if (dimensions.y > height || width + dimensions.x + 1 > max_width)
+		return false;
 
-		TextureLayoutRectangle& rectangle = layout.GetRectangle(index);
+	rectangle.Place(texture_index, Vector2i(width, y));
 
-		// Increment the row height if necessary.
-		height = Math::Max(height, rectangle.GetDimensions().y);
+	// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
+	// against each other. This will avoid filtering artifacts.
+	if (dimensions.x > 0)
+		width += dimensions.x + 1;
 
-		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
-		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
-		++placed_rectangles;
-
-		// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
-		// against each other. This will avoid filtering artifacts.
-		if (rectangle.GetDimensions().x > 0)
-			width += rectangle.GetDimensions().x + 1;
-
-		first_unplaced_index = index + 1;
-	}
-
-	return placed_rectangles;
+	return true;
 }
 
-// Assigns allocated texture data to all rectangles in this row.
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+// Returns the y-coordinate of the row.
+int TextureLayoutRow::GetY() const
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	return y;
 }
 
 // Returns the height of the row.
@@ -98,11 +65,4 @@ int TextureLayoutRow::GetHeight() const
 	return height;
 }
 
-// Resets the placed status for all of the rectangles within this row.
-void TextureLayoutRow::Unplace()
-{
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
-}
-
 } // namespace Rml
@@ -33,10 +33,10 @@
 
 namespace Rml {
 
-class TextureLayout;
-
 /**
-	A texture layout row is a single row of rectangles positioned vertically within a texture.
+	A texture layout row is a single row of rectangles positioned vertically within a texture. The
+	height of the row is fixed when it is opened, rectangles are then appended to the end of the row
+	for as long as they fit.
 
 	@author Peter
  */
@@ -44,33 +44,29 @@ class TextureLayout;
 class TextureLayoutRow
 {
 public:
-	TextureLayoutRow();
-	~TextureLayoutRow();
-
-	/// Attempts to position unplaced rectangles from the layout into this row.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] width The maximum width of this row.
+	/// Opens a new row.
 	/// @param[in] y The y-coordinate of this row.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	/// @param[in] height The height of this row.
+	TextureLayoutRow(int y, int height);
+	~TextureLayoutRow();
 
-	/// Assigns allocated texture data to all rectangles in this row.
-	/// @param[in] texture_data The pointer to the beginning of the texture's data.
-	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	/// Attempts to position a rectangle at the end of this row.
+	/// @param[in] rectangle The rectangle to place.
+	/// @param[in] texture_index The index of the texture this row belongs to.
+	/// @param[in] max_width The maximum width of this row.
+	/// @return True if the rectangle was placed, false if it does not fit.
+	bool Place(TextureLayoutRectangle& rectangle, int texture_index, int max_width);
 
+	/// Returns the y-coordinate of the row.
+	int GetY() const;
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
 
-	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
-
 private:
-	using RectangleList = Vector< TextureLayoutRectangle* >;
-
+	int y;
 	int height;
-	RectangleList rectangles;
+	int width;
 };
 
 } // namespace Rml
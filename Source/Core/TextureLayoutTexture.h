@@ -34,12 +34,11 @@
 
 namespace Rml {
 
-class TextureLayout;
-class TextureResource;
-
 /**
 	A texture layout texture is a single rectangular area which sub-rectangles are placed on within
-	a complete texture layout.
+	a complete texture layout. The texture has fixed dimensions, so that new rectangles can be placed
+	in the remaining space without moving any previous rectangles. The texture data is only held
+	until it is taken for uploading to the render interface.
 
 	@author Peter
  */
@@ -47,29 +46,40 @@ class TextureResource;
 class TextureLayoutTexture
 {
 public:
-	TextureLayoutTexture();
+	/// Creates an empty texture, without allocating its data.
+	/// @param[in] dimensions The dimensions of the texture.
+	TextureLayoutTexture(Vector2i dimensions);
+	TextureLayoutTexture(TextureLayoutTexture&&) = default;
+	TextureLayoutTexture& operator=(TextureLayoutTexture&&) = default;
 	~TextureLayoutTexture();
 
-	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
+	/// Returns the texture's dimensions.
 	/// @return The texture's dimensions.
 	Vector2i GetDimensions() const;
 
-	/// Attempts to position unplaced rectangles from the layout into this texture. The size of
-	/// this texture will be determined by its contents.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will be placed as possible.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
+	/// Attempts to position a rectangle into the remaining space of this texture.
+	/// @param[in] rectangle The rectangle to place.
+	/// @param[in] texture_index The index of this texture within the layout.
+	/// @return True if the rectangle was placed, false if there is not enough space left.
+	bool Place(TextureLayoutRectangle& rectangle, int texture_index);
 
-	/// Allocates the texture.
-	/// @return The allocated texture data.
-	UniquePtr<byte[]> AllocateTexture();
+	/// Allocates the texture data, with four bytes per pixel initialized to transparent white.
+	/// @return The texture data, owned by the texture until taken.
+	byte* AllocateTextureData();
+	/// Returns the texture data, or nullptr if it has not been allocated or has been taken.
+	byte* GetTextureData();
+	/// Releases ownership of the texture data, as required by texture callbacks.
+	/// @return The texture data, or nullptr if it has not been allocated or has been taken.
+	UniquePtr<byte[]> TakeTextureData();
+	/// Returns the stride of the texture data, in bytes.
+	int GetTextureStride() const;
 
 private:
 	using RowList = Vector< TextureLayoutRow >;
 
 	Vector2i dimensions;
 	RowList rows;
+	UniquePtr<byte[]> texture_data;
 };
 
 } // namespace Rml
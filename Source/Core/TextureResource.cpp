@@ -34,6 +34,8 @@
 
 namespace Rml {
 
+static int texture_change_counter = 0;
+
 TextureResource::TextureResource()
 {
 }
@@ -49,14 +51,51 @@ void TextureResource::Set(const String& _source)
 	source = _source;
 }
 
-void TextureResource::Set(const String& name, const TextureCallback& callback)
+void TextureResource::Set(const String& name, const TextureCallback& callback, bool _distance_field)
 {
 	Reset();
 	source = name;
 	texture_callback = MakeUnique<TextureCallback>(callback);
+	distance_field = _distance_field;
 	TextureDatabase::AddCallbackTexture(this);
 }
 
+void TextureResource::Update(Vector2i region_offset, Vector2i region_dimensions, const byte* data, int data_stride)
+{
+	if (!texture_callback)
+	{
+		Log::Message(Log::LT_WARNING, "Texture '%s' can not be updated as it was not generated from a callback function.", source.c_str());
+		return;
+	}
+
+	for (auto it = texture_data.begin(); it != texture_data.end();)
+	{
+		RenderInterface* render_interface = it->first;
+		const TextureHandle handle = it->second.first;
+		const Vector2i dimensions = it->second.second;
+
+		const bool region_valid = (region_offset.x >= 0 && region_offset.y >= 0 && region_offset.x + region_dimensions.x <= dimensions.x &&
+			region_offset.y + region_dimensions.y <= dimensions.y);
+
+		if (handle && region_valid && render_interface->SupportsTextureUpdates() &&
+			render_interface->UpdateTexture(handle, region_offset, region_dimensions, data, data_stride))
+		{
+			texture_change_counter += 1;
+			++it;
+			continue;
+		}
+
+		// Updates are not possible, release the texture so that it is generated again from the callback.
+		if (handle)
+		{
+			render_interface->ReleaseTexture(handle);
+			texture_change_counter += 1;
+		}
+
+		it = texture_data.erase(it);
+	}
+}
+
 void TextureResource::Reset()
 {
 	Release();
@@ -68,6 +107,7 @@ void TextureResource::Reset()
 	}
 
 	source.clear();
+	distance_field = false;
 }
 
 // Returns the resource's underlying texture.
@@ -111,7 +151,10 @@ void TextureResource::Release(RenderInterface* render_interface)
 		{
 			TextureHandle handle = interface_data_pair.second.first;
 			if (handle)
+			{
 				interface_data_pair.first->ReleaseTexture(handle);
+				texture_change_counter += 1;
+			}
 		}
 
 		texture_data.clear();
@@ -124,12 +167,20 @@ void TextureResource::Release(RenderInterface* render_interface)
 
 		TextureHandle handle = texture_iterator->second.first;
 		if (handle)
+		{
 			texture_iterator->first->ReleaseTexture(handle);
+			texture_change_counter += 1;
+		}
 
 		texture_data.erase(render_interface);
 	}
 }
 
+int TextureResource::GetChangeCounter()
+{
+	return texture_change_counter;
+}
+
 bool TextureResource::Load(RenderInterface* render_interface)
 {
 	RMLUI_ZoneScoped;
@@ -151,7 +202,8 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		}
 
 		TextureHandle handle;
-		bool success = render_interface->GenerateTexture(handle, data.get(), dimensions);
+		bool success = (distance_field ? render_interface->GenerateDistanceFieldTexture(handle, data.get(), dimensions)
+									   : render_interface->GenerateTexture(handle, data.get(), dimensions));
 
 		if (success)
 		{
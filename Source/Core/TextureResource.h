@@ -52,7 +52,11 @@ public:
 
 	/// Clear any existing data and set a callback function for loading the data.
 	/// Texture loading is delayed until the texture is accessed by a specific render interface.
-	void Set(const String& name, const TextureCallback& callback);
+	void Set(const String& name, const TextureCallback& callback, bool distance_field);
+
+	/// Updates a region of a callback texture for each render interface holding it. Render interfaces which do not support texture
+	/// updates have their texture released instead, to be generated again by the callback on next use.
+	void Update(Vector2i region_offset, Vector2i region_dimensions, const byte* data, int data_stride);
 
 	/// Returns the resource's underlying texture handle.
 	TextureHandle GetHandle(RenderInterface* render_interface);
@@ -65,6 +69,9 @@ public:
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
+	/// Returns a counter which is incremented whenever any texture handle is released or updated.
+	static int GetChangeCounter();
+
 	/// For debugging. Returns true if the texture holds a reference to the given render interface, otherwise false.
 	inline bool HoldsRenderInterface(RenderInterface* render_interface) const { return texture_data.count(render_interface); }
 
@@ -81,6 +88,7 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+	bool distance_field = false;
 };
 
 } // namespace Rml
@@ -165,6 +165,13 @@ void WidgetScroll::Update()
 			}
 		}
 	}
+
+	// Keep updating while any of the arrow buttons are held down.
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+	{
+		if (Element* element_scroll = parent->GetParentNode())
+			element_scroll->DirtyUpdate();
+	}
 }
 
 // Sets the position of the bar.
@@ -432,12 +439,16 @@ void WidgetScroll::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			if (Element* element_scroll = parent->GetParentNode())
+				element_scroll->DirtyUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			if (Element* element_scroll = parent->GetParentNode())
+				element_scroll->DirtyUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
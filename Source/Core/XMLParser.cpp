@@ -176,7 +176,8 @@ void XMLParser::HandleElementEnd(const String& _name)
 	// Check frame names
 	if (name != frame.tag)
 	{
-		Log::Message(Log::LT_ERROR, "Closing tag '%s' mismatched on %s:%d was expecting '%s'.", name.c_str(), GetSourceURL().GetURL().c_str(), GetLineNumber(), frame.tag.c_str());
+		const String source_url = (GetSourceURLPtr() ? GetSourceURLPtr()->GetURL() : String());
+		Log::Message(Log::LT_ERROR, "Closing tag '%s' mismatched on %s:%d was expecting '%s'.", name.c_str(), source_url.c_str(), GetLineNumber(), frame.tag.c_str());
 	}
 
 	// Call element end handler
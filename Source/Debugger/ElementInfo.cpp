@@ -94,6 +94,9 @@ void ElementInfo::Reset()
 
 void ElementInfo::OnUpdate()
 {
+	// Poll the source element for changes on every frame.
+	DirtyUpdate();
+
 	if (source_element && (update_source_element || force_update_once) && IsVisible())
 	{
 		const double t = GetSystemInterface()->GetElapsedTime();
@@ -28,6 +28,7 @@
 
 #include "Geometry.h"
 #include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 
@@ -45,14 +46,28 @@ void Geometry::SetContext(Context* _context)
 	context = _context;
 }
 
+// Renders untextured geometry through the context's render interface.
+static void RenderGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, const Vector2f origin)
+{
+	if (context->GetRenderBatching())
+	{
+		// Render through a core geometry so that it is recorded in order with the rest of the context's batched geometry.
+		Rml::Geometry geometry(context);
+		geometry.GetVertices().assign(vertices, vertices + num_vertices);
+		geometry.GetIndices().assign(indices, indices + num_indices);
+		geometry.Render(origin);
+		return;
+	}
+
+	context->GetRenderInterface()->RenderGeometry(vertices, num_vertices, indices, num_indices, 0, origin);
+}
+
 // Renders a one-pixel rectangular outline.
 void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, const Colourb colour, float width)
 {
 	if (context == nullptr)
 		return;
 
-	RenderInterface* render_interface = context->GetRenderInterface();
-
 	Vertex vertices[4 * 4];
 	int indices[6 * 4];
 
@@ -61,7 +76,7 @@ void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, c
 	GeometryUtilities::GenerateQuad(vertices + 8, indices + 12, Vector2f(0, 0), Vector2f(width, dimensions.y), colour, 8);
 	GeometryUtilities::GenerateQuad(vertices + 12, indices + 18, Vector2f(dimensions.x - width, 0), Vector2f(width, dimensions.y), colour, 12);
 
-	render_interface->RenderGeometry(vertices, 4 * 4, indices, 6 * 4, 0, origin);
+	RenderGeometry(vertices, 4 * 4, indices, 6 * 4, origin);
 }
 
 // Renders a box.
@@ -70,14 +85,12 @@ void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const
 	if (context == nullptr)
 		return;
 
-	RenderInterface* render_interface = context->GetRenderInterface();
-
 	Vertex vertices[4];
 	int indices[6];
 
 	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(0, 0), Vector2f(dimensions.x, dimensions.y), colour, 0);
 
-	render_interface->RenderGeometry(vertices, 4, indices, 6, 0, origin);
+	RenderGeometry(vertices, 4, indices, 6, origin);
 }
 
 // Renders a box with a hole in the middle.
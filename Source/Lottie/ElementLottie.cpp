@@ -60,6 +60,20 @@ bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 	return true;
 }
 
+void ElementLottie::OnUpdate()
+{
+	Element::OnUpdate();
+
+	if (animation)
+	{
+		AdvanceAnimation();
+
+		// Clean elements are skipped by the update loop. Keep updating while the animation is playing, which also tells the context
+		// that the next frame must be rendered again instead of replaying the previous one.
+		DirtyUpdate();
+	}
+}
+
 void ElementLottie::OnRender()
 {
 	if (animation)
@@ -134,6 +148,7 @@ bool ElementLottie::LoadAnimation()
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
 	animation.reset();
+	animation_frame = 0;
 	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
 
@@ -173,14 +188,14 @@ bool ElementLottie::LoadAnimation()
 	intrinsic_dimensions.x = float(width);
 	intrinsic_dimensions.y = float(height);
 
+	// Start advancing the animation during update.
+	DirtyUpdate();
+
 	return true;
 }
 
-void ElementLottie::UpdateTexture()
+void ElementLottie::AdvanceAnimation()
 {
-	if (!animation)
-		return;
-
 	const double t = GetSystemInterface()->GetElapsedTime();
 
 	if (time_animation_start < 0.0)
@@ -192,41 +207,39 @@ void ElementLottie::UpdateTexture()
 	// Find the normalized animation progress [0, 1].
 	const double pos = std::modf((t - time_animation_start) / animation->duration(), &_unused);
 
-	const size_t next_frame = animation->frameAtPos(pos);
+	animation_frame = animation->frameAtPos(pos);
+}
+
+void ElementLottie::UpdateTexture()
+{
+	if (!animation)
+		return;
+
+	const size_t next_frame = animation_frame;
 	if (!texture_size_dirty && next_frame == prev_animation_frame)
 	{
 		// No need to update the texture if we are drawing the same frame at the same size.
 		return;
 	}
 
-	// Callback for generating texture.
-	auto p_callback = [this, next_frame](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-		RMLUI_ASSERT(animation);
-
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
+	prev_animation_frame = next_frame;
 
-		byte* p_data = new byte[total_bytes];
+	if (!texture_size_dirty && texture)
+	{
+		// Same size as before, update the existing texture in place where supported by the render interface.
+		UniquePtr<byte[]> data(new byte[4 * render_dimensions.x * render_dimensions.y]);
+		RenderAnimationFrame(data.get(), next_frame);
+		texture.Update(Vector2i(0, 0), render_dimensions, data.get(), 4 * render_dimensions.x);
+		geometry.SetTexture(&texture);
+		return;
+	}
 
-		rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
+	// Callback for generating texture. The texture may be regenerated later, thus we render the latest frame at that time.
+	auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+		RMLUI_ASSERT(animation);
 
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
-		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
-
-			const byte a = p_data[i + 3];
-
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			if (a > 0 && a < 255)
-			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
-			}
-		}
+		byte* p_data = new byte[4 * render_dimensions.x * render_dimensions.y];
+		RenderAnimationFrame(p_data, prev_animation_frame);
 
 		data.reset(p_data);
 		dimensions = render_dimensions;
@@ -236,8 +249,33 @@ void ElementLottie::UpdateTexture()
 
 	texture.Set("lottie", p_callback);
 	geometry.SetTexture(&texture);
-	prev_animation_frame = next_frame;
 	texture_size_dirty = false;
 }
 
+void ElementLottie::RenderAnimationFrame(byte* p_data, size_t frame)
+{
+	const size_t bytes_per_line = 4 * render_dimensions.x;
+	const size_t total_bytes = bytes_per_line * render_dimensions.y;
+
+	rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
+	animation->renderSync(frame, surface);
+
+	// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
+	for (size_t i = 0; i < total_bytes; i += 4)
+	{
+		// Swap the RB order for correct color channels.
+		std::swap(p_data[i], p_data[i + 2]);
+
+		const byte a = p_data[i + 3];
+
+		// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
+		// Here, we un-premultiply the colors.
+		if (a > 0 && a < 255)
+		{
+			for (size_t j = 0; j < 3; j++)
+				p_data[i + j] = (p_data[i + j] * 255) / a;
+		}
+	}
+}
+
 } // namespace Rml
@@ -196,6 +196,16 @@ void ElementSVG::UpdateTexture()
 	if (!svg_document || !texture_dirty)
 		return;
 
+	if (texture && texture_dimensions == render_dimensions)
+	{
+		// Same size as before, update the existing texture in place where supported by the render interface.
+		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
+		texture.Update(Vector2i(0, 0), render_dimensions, bitmap.data(), 4 * render_dimensions.x);
+		geometry.SetTexture(&texture);
+		texture_dirty = false;
+		return;
+	}
+
 	// Callback for generating texture.
 	auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
 		RMLUI_ASSERT(svg_document);
@@ -213,6 +223,7 @@ void ElementSVG::UpdateTexture()
 
 	texture.Set("svg", p_callback);
 	geometry.SetTexture(&texture);
+	texture_dimensions = render_dimensions;
 	texture_dirty = false;
 }
 
@@ -245,3 +245,86 @@ TEST_CASE("data_binding")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_inventory_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window
+		{
+			left: 50px;
+			right: 50px;
+			top: 30px;
+			bottom: 30px;
+			max-width: -1px;
+			max-height: -1px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div data-model="inventory">
+<p data-for="item : inventory">{{ item.name }}: {{ item.count }}</p>
+</div>
+</body>
+</rml>
+)";
+
+struct InventoryItem {
+	String name;
+	int count = 0;
+};
+
+TEST_CASE("data_binding.large_array")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_items = 5000;
+
+	Vector<InventoryItem> inventory(num_items);
+	for (int i = 0; i < num_items; i++)
+		inventory[i].name = "Item " + ToString(i);
+
+	DataModelConstructor constructor = context->CreateDataModel("inventory");
+	REQUIRE(static_cast<bool>(constructor));
+	if (auto handle = constructor.RegisterStruct<InventoryItem>())
+	{
+		handle.RegisterMember("name", &InventoryItem::name);
+		handle.RegisterMember("count", &InventoryItem::count);
+	}
+	constructor.RegisterArray<Vector<InventoryItem>>();
+	constructor.Bind("inventory", &inventory);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_inventory_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	nanobench::Rng rng;
+	nanobench::Bench bench;
+	bench.title("Data bindings: Large array");
+	bench.relative(true);
+
+	bench.run("Dirty whole array", [&] {
+		inventory[42].count = rng.bounded(1000);
+		model_handle.DirtyVariable("inventory");
+		context->Update();
+	});
+
+	bench.run("Dirty single element", [&] {
+		inventory[42].count = rng.bounded(1000);
+		model_handle.DirtyVariable("inventory[42].count");
+		context->Update();
+	});
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -70,7 +70,8 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		Vector<DataAddressCache> address_cache;
+		DataInterpreter interpreter(program, addresses, address_cache, interface);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
@@ -103,7 +104,8 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		Vector<DataAddressCache> address_cache;
+		DataInterpreter interpreter(program, addresses, address_cache, interface);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
@@ -123,4 +125,38 @@ TEST_CASE("data_expressions")
 		"Complex assign (parse)",
 		"Complex assign (execute)"
 	);
+
+	// Compiled programs read variables through their cached addresses, with constant subexpressions folded and operators specialized.
+	auto bench_compiled = [&](const String& expression, bool is_assignment_expression, const char* execute_name) {
+		DataParser parser(expression, interface);
+		REQUIRE(parser.Parse(is_assignment_expression));
+
+		Program program = parser.ReleaseProgram();
+		AddressList addresses = parser.ReleaseAddresses();
+		Program compiled_program = CompileProgram(program, addresses);
+		Vector<DataAddressCache> address_cache;
+		DataInterpreter interpreter(program, addresses, address_cache, interface);
+		DataInterpreter compiled_interpreter(compiled_program, addresses, address_cache, interface);
+
+		bool result = true;
+		bench.run(execute_name, [&] {
+			result &= compiled_interpreter.Run();
+		});
+
+		REQUIRE(result);
+		REQUIRE(interpreter.Run());
+		CHECK(compiled_interpreter.Result() == interpreter.Result());
+	};
+
+	bench_compiled("2 * 2", false, "Simple (execute compiled)");
+	bench_compiled("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", false, "Complex (execute compiled)");
+	bench_compiled("radius = 15", true, "Simple assign (execute compiled)");
+	bench_compiled("radius = radius*radius*3.14; color_name = 'image-color'", true, "Complex assign (execute compiled)");
+
+	bench_expression(
+		"radius * radius * 3.14 > 100 && color_name == 'color'",
+		"Variables (parse)",
+		"Variables (execute)"
+	);
+	bench_compiled("radius * radius * 3.14 > 100 && color_name == 'color'", false, "Variables (execute compiled)");
 }
@@ -29,7 +29,10 @@
 #include "TestsInterface.h"
 #include <RmlUi/Core/Log.h>
 #include <RmlUi/Core/StringUtilities.h>
+#include <atomic>
 #include <doctest.h>
+#include <string.h>
+#include <thread>
 
 double TestsSystemInterface::GetElapsedTime()
 {
@@ -83,11 +86,77 @@ void TestsSystemInterface::SetTime(double t)
 	elapsed_time = t;
 }
 
+int TestsSystemInterface::GetNumWorkerThreads()
+{
+	return num_worker_threads;
+}
+
+void TestsSystemInterface::RunParallelTasks(int num_tasks, const Rml::Function<void(int)>& task)
+{
+	std::atomic<int> next_task(0);
+	auto run_tasks = [&]() {
+		for (int i = next_task++; i < num_tasks; i = next_task++)
+			task(i);
+	};
+
+	Rml::Vector<std::thread> threads;
+	for (int i = 0; i < num_worker_threads; i++)
+		threads.emplace_back(run_tasks);
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void TestsSystemInterface::SetNumWorkerThreads(int num_threads)
+{
+	num_worker_threads = num_threads;
+}
+
 void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
 {
 	counters.render_calls += 1;
 }
 
+void TestsRenderInterface::RenderBatchedGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/,
+	const Rml::TextureHandle /*texture*/)
+{
+	counters.render_batched_calls += 1;
+}
+
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* /*indices*/, int /*num_indices*/,
+	Rml::TextureHandle /*texture*/)
+{
+	if (!compiled_geometry_supported)
+		return 0;
+
+	counters.compile_geometry += 1;
+	last_compiled_vertices.assign(vertices, vertices + num_vertices);
+	return (Rml::CompiledGeometryHandle)counters.compile_geometry;
+}
+
+void TestsRenderInterface::RenderCompiledGeometry(Rml::CompiledGeometryHandle /*geometry*/, const Rml::Vector2f& /*translation*/)
+{
+	counters.render_compiled_calls += 1;
+	last_colour_multiplier = Rml::Colourb(255);
+}
+
+bool TestsRenderInterface::SupportsColourMultiplier()
+{
+	return colour_multiplier_supported;
+}
+
+void TestsRenderInterface::RenderCompiledGeometryWithColour(Rml::CompiledGeometryHandle /*geometry*/, const Rml::Vector2f& /*translation*/,
+	const Rml::Colourb& colour_multiplier)
+{
+	counters.render_compiled_with_colour_calls += 1;
+	last_colour_multiplier = colour_multiplier;
+}
+
+void TestsRenderInterface::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle /*geometry*/)
+{
+	counters.release_compiled_geometry += 1;
+}
+
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
 {
 	counters.enable_scissor += 1;
@@ -107,9 +176,42 @@ bool TestsRenderInterface::LoadTexture(Rml::TextureHandle& texture_handle, Rml::
 	return true;
 }
 
-bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* /*source*/, const Rml::Vector2i& /*source_dimensions*/)
+bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions)
 {
 	counters.generate_texture += 1;
+	last_texture_data.assign(source, source + source_dimensions.x * source_dimensions.y * 4);
+	last_texture_dimensions = source_dimensions;
+	texture_handle = 1;
+	return true;
+}
+
+bool TestsRenderInterface::SupportsTextureUpdates()
+{
+	return texture_updates_supported;
+}
+
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, const Rml::Vector2i& region_offset,
+	const Rml::Vector2i& region_dimensions, const Rml::byte* source, int source_stride)
+{
+	counters.update_texture += 1;
+	if (region_offset.x + region_dimensions.x <= last_texture_dimensions.x && region_offset.y + region_dimensions.y <= last_texture_dimensions.y)
+	{
+		for (int y = 0; y < region_dimensions.y; y++)
+			memcpy(last_texture_data.data() + ((region_offset.y + y) * last_texture_dimensions.x + region_offset.x) * 4, source + y * source_stride,
+				region_dimensions.x * 4);
+	}
+	return true;
+}
+
+bool TestsRenderInterface::SupportsDistanceFieldTextures()
+{
+	return distance_field_textures_supported;
+}
+
+bool TestsRenderInterface::GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* /*source*/,
+	const Rml::Vector2i& /*source_dimensions*/)
+{
+	counters.generate_distance_field_texture += 1;
 	texture_handle = 1;
 	return true;
 }
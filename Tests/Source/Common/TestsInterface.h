@@ -45,8 +45,15 @@ public:
 
 	void SetTime(double t);
 
+	int GetNumWorkerThreads() override;
+	void RunParallelTasks(int num_tasks, const Rml::Function<void(int)>& task) override;
+
+	// Sets the number of threads to spawn for parallel tasks, zero disables parallel tasks.
+	void SetNumWorkerThreads(int num_threads);
+
 private:
 	double elapsed_time = 0.0;
+	int num_worker_threads = 0;
 
 	int num_logged_warnings = 0;
 	int num_expected_warnings = 0;
@@ -58,32 +65,77 @@ class TestsRenderInterface : public Rml::RenderInterface {
 public:
 	struct Counters {
 		size_t render_calls;
+		size_t render_batched_calls;
+		size_t compile_geometry;
+		size_t render_compiled_calls;
+		size_t render_compiled_with_colour_calls;
+		size_t release_compiled_geometry;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
+		size_t generate_distance_field_texture;
+		size_t update_texture;
 		size_t release_texture;
 		size_t set_transform;
 	};
 
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
 		const Rml::Vector2f& translation) override;
+	void RenderBatchedGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture) override;
+
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
+		Rml::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	bool SupportsColourMultiplier() override;
+	void RenderCompiledGeometryWithColour(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation,
+		const Rml::Colourb& colour_multiplier) override;
+	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
 
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool SupportsTextureUpdates() override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::Vector2i& region_offset, const Rml::Vector2i& region_dimensions,
+		const Rml::byte* source, int source_stride) override;
+	bool SupportsDistanceFieldTextures() override;
+	bool GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
 	const Counters& GetCounters() const { return counters; }
+	// Returns the vertices of the most recently compiled geometry.
+	const Rml::Vector<Rml::Vertex>& GetLastCompiledVertices() const { return last_compiled_vertices; }
+	// Returns the colour multiplier of the most recently rendered compiled geometry.
+	Rml::Colourb GetLastColourMultiplier() const { return last_colour_multiplier; }
+	// Returns the data of the most recently generated texture, including any later updates to it.
+	const Rml::Vector<Rml::byte>& GetLastTextureData() const { return last_texture_data; }
 
 	void ResetCounters() { counters = {}; }
 
+	// Texture updates are disabled by default, so that textures are regenerated whenever they change.
+	void SetTextureUpdatesSupported(bool supported) { texture_updates_supported = supported; }
+	// Distance field textures are disabled by default.
+	void SetDistanceFieldTexturesSupported(bool supported) { distance_field_textures_supported = supported; }
+	// Compiled geometry is disabled by default, so that geometry is rendered directly every frame.
+	void SetCompiledGeometrySupported(bool supported) { compiled_geometry_supported = supported; }
+	// Colour multipliers are disabled by default.
+	void SetColourMultiplierSupported(bool supported) { colour_multiplier_supported = supported; }
+
 private:
 	Counters counters = {};
+	bool texture_updates_supported = false;
+	bool distance_field_textures_supported = false;
+	bool compiled_geometry_supported = false;
+	bool colour_multiplier_supported = false;
+
+	Rml::Vector<Rml::Vertex> last_compiled_vertices;
+	Rml::Colourb last_colour_multiplier = Rml::Colourb(255);
+	Rml::Vector<Rml::byte> last_texture_data;
+	Rml::Vector2i last_texture_dimensions;
 };
 
 #endif
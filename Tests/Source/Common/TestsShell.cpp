@@ -198,6 +198,7 @@ Rml::String TestsShell::GetRenderStats()
 	result = Rml::CreateString(256,
 		"Context::Render() stats:\n"
 		"  Render calls: %zu\n"
+		"  Batched render calls: %zu\n"
 		"  Scissor enable: %zu\n"
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
@@ -205,6 +206,7 @@ Rml::String TestsShell::GetRenderStats()
 		"  Texture release: %zu\n"
 		"  Transform set: %zu",
 		counters.render_calls,
+		counters.render_batched_calls,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
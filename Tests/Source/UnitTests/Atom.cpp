@@ -0,0 +1,113 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/Atom.h"
+#include <RmlUi/Core/TypeConverter.h>
+#include <RmlUi/Core/Types.h>
+#include <algorithm>
+#include <doctest.h>
+#include <thread>
+
+using namespace Rml;
+
+TEST_CASE("Atom.identity")
+{
+	const Atom a = MakeAtom("atom-test-a");
+	const Atom b = MakeAtom("atom-test-b");
+
+	CHECK(a != Atom::Invalid);
+	CHECK(b != Atom::Invalid);
+	CHECK(a != b);
+	CHECK(MakeAtom("atom-test-a") == a);
+	CHECK(MakeAtom(String("atom-test-") + "b") == b);
+
+	CHECK(FindAtom("atom-test-a") == a);
+	CHECK(MakeAtom("") == Atom::Invalid);
+	CHECK(FindAtom("") == Atom::Invalid);
+
+	const size_t num_atoms = GetNumAtoms();
+	CHECK(FindAtom("atom-test-never-made") == Atom::Invalid);
+	CHECK(GetNumAtoms() == num_atoms);
+}
+
+TEST_CASE("Atom.round_trip")
+{
+	const Atom a = MakeAtom("atom-test-round-trip");
+	const String& name = GetAtomName(a);
+	CHECK(name == "atom-test-round-trip");
+	CHECK(GetAtomName(Atom::Invalid).empty());
+
+	// References to atom names remain valid when the table grows.
+	for (int i = 0; i < 1000; i++)
+		MakeAtom("atom-test-grow-" + ToString(i));
+	CHECK(name == "atom-test-round-trip");
+	CHECK(MakeAtom(name) == a);
+}
+
+TEST_CASE("Atom.list")
+{
+	const Atom a = MakeAtom("atom-test-list-a");
+	const Atom b = MakeAtom("atom-test-list-b");
+
+	AtomList list;
+	CHECK(InsertAtom(list, b));
+	CHECK(InsertAtom(list, a));
+	CHECK_FALSE(InsertAtom(list, a));
+	CHECK(list.size() == 2);
+	CHECK(std::is_sorted(list.begin(), list.end()));
+
+	CHECK(ContainsAtom(list, a));
+	CHECK(EraseAtom(list, a));
+	CHECK_FALSE(EraseAtom(list, a));
+	CHECK_FALSE(ContainsAtom(list, a));
+	CHECK(ContainsAtom(list, b));
+}
+
+TEST_CASE("Atom.threads")
+{
+	constexpr int num_threads = 4;
+	constexpr int num_names = 500;
+
+	Vector<Vector<Atom>> results(num_threads);
+	Vector<std::thread> threads;
+	for (int t = 0; t < num_threads; t++)
+	{
+		threads.emplace_back([t, &results]() {
+			for (int i = 0; i < num_names; i++)
+				results[t].push_back(MakeAtom("atom-test-thread-" + ToString(i)));
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (int t = 1; t < num_threads; t++)
+		CHECK(results[t] == results[0]);
+
+	for (int i = 0; i < num_names; i++)
+		CHECK(GetAtomName(results[0][i]) == "atom-test-thread-" + ToString(i));
+}
@@ -26,14 +26,22 @@
  *
  */
 
+#include "../../../Source/Core/FontEngineDefault/FontFaceHandleDefault.h"
+#include "../../../Source/Core/FontEngineDefault/FontKerningCache.h"
+#include "../../../Source/Core/FontEngineDefault/FontProvider.h"
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <algorithm>
 #include <doctest.h>
+#include <stdio.h>
 
 using namespace Rml;
 
@@ -158,6 +166,7 @@ TEST_CASE("core.release_textures")
 	{
 		const auto counter_generate_before = counters.generate_texture;
 		const auto counter_release_before = counters.release_texture;
+		const int font_version_before = GetFontEngineInterface()->GetVersion(element->GetFontFaceHandle());
 
 		// Verify that ASCII characters are cached during the first use of the font. Then the font texture should not be regenerated when adding ASCII
 		// characters not previously shown.
@@ -170,6 +179,18 @@ TEST_CASE("core.release_textures")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before + 1);
 		CHECK(counters.release_texture == counter_release_before + 1);
+
+		// The new glyph is added to the existing font texture, thus previously generated text geometry remains valid.
+		CHECK(GetFontEngineInterface()->GetVersion(element->GetFontFaceHandle()) == font_version_before);
+
+		// When the render interface supports texture updates, the new glyph is uploaded to the existing font texture instead.
+		render_interface->SetTextureUpdatesSupported(true);
+		element->SetInnerRML(reinterpret_cast<const char*>(u8"ä"));
+		TestsShell::RenderLoop();
+		CHECK(counters.update_texture == 1);
+		CHECK(counters.generate_texture == counter_generate_before + 1);
+		CHECK(counters.release_texture == counter_release_before + 1);
+		render_interface->SetTextureUpdatesSupported(false);
 	}
 
 	document->Close();
@@ -179,3 +200,737 @@ TEST_CASE("core.release_textures")
 	// Finally, verify that all generated and loaded textures are released during shutdown.
 	CHECK(counters.generate_texture + counters.load_texture == counters.release_texture);
 }
+
+static const String document_font_texture_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 18px;
+			color: #fff;
+		}
+	</style>
+</head>
+
+<body>
+<p id="text">Hello world</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.font_texture_updates")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	render_interface->ResetCounters();
+	render_interface->SetTextureUpdatesSupported(true);
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_texture_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	REQUIRE(counters.generate_texture == 1);
+	const Vector<byte> texture_data_initial = render_interface->GetLastTextureData();
+
+	// New glyphs are only uploaded for the region they occupy in the existing texture.
+	document->GetElementById("text")->SetInnerRML(reinterpret_cast<const char*>(u8"Hello wörld π"));
+	TestsShell::RenderLoop();
+	CHECK(counters.generate_texture == 1);
+	CHECK(counters.update_texture == 1);
+
+	const Vector<byte> texture_data_updated = render_interface->GetLastTextureData();
+	CHECK(texture_data_updated != texture_data_initial);
+
+	// The texture data is not kept after uploading, thus a released texture is rendered again from the glyphs. This should produce
+	// the same result as the initial texture with its updated region.
+	Rml::ReleaseTextures();
+	TestsShell::RenderLoop();
+	CHECK(counters.generate_texture == 2);
+	CHECK(render_interface->GetLastTextureData() == texture_data_updated);
+
+	render_interface->SetTextureUpdatesSupported(false);
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_font_sizes_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			color: #fff;
+		}
+	</style>
+</head>
+
+<body>
+<p style="font-size: 12px">Hello world</p>
+<p style="font-size: 16px">Hello world</p>
+<p style="font-size: 23px">Hello world</p>
+<p style="font-size: 40px">Hello world</p>
+<p style="font-size: 71px">Hello world</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.distance_field_fonts")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	auto RenderDocument = [&](bool distance_field_rendering) {
+		render_interface->ResetCounters();
+		Context* context = TestsShell::GetContext();
+		REQUIRE(context);
+
+		if (distance_field_rendering)
+			Rml::SetFontDistanceFieldRendering(true);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_font_sizes_rml);
+		REQUIRE(document);
+		document->Show();
+		TestsShell::RenderLoop();
+
+		// Font sizes rendered from distance fields only need the metrics of their glyphs, not the bitmaps.
+		FontFaceHandleDefault* handle = FontProvider::GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 23);
+		REQUIRE(handle);
+		auto it_glyph = handle->GetGlyphs().find(Character('H'));
+		REQUIRE(it_glyph != handle->GetGlyphs().end());
+		CHECK(it_glyph->second.advance > 0);
+		CHECK((it_glyph->second.bitmap_data == nullptr) == FontProvider::IsDistanceFieldRenderingEnabled());
+
+		document->Close();
+
+		const auto counters_rendered = counters;
+		TestsShell::ShutdownShell();
+
+		// All font textures should be released during shutdown, including the distance field textures.
+		CHECK(counters.generate_texture + counters.generate_distance_field_texture == counters.release_texture);
+		return counters_rendered;
+	};
+
+	// Without distance field rendering, every font size generates its own glyph texture.
+	const auto counters_bitmap = RenderDocument(false);
+	CHECK(counters_bitmap.generate_texture >= 5);
+	CHECK(counters_bitmap.generate_distance_field_texture == 0);
+
+	// Enabling distance field rendering has no effect unless the render interface supports it.
+	const auto counters_unsupported = RenderDocument(true);
+	CHECK(counters_unsupported.generate_texture == counters_bitmap.generate_texture);
+	CHECK(counters_unsupported.generate_distance_field_texture == 0);
+
+	// With support, all font sizes share the distance field texture of the font face.
+	render_interface->SetDistanceFieldTexturesSupported(true);
+	const auto counters_distance_field = RenderDocument(true);
+	CHECK(counters_distance_field.generate_texture == 0);
+	CHECK(counters_distance_field.generate_distance_field_texture == 1);
+
+	// Distance field rendering is disabled again after shutdown.
+	const auto counters_reinitialized = RenderDocument(false);
+	CHECK(counters_reinitialized.generate_texture == counters_bitmap.generate_texture);
+	CHECK(counters_reinitialized.generate_distance_field_texture == 0);
+
+	render_interface->SetDistanceFieldTexturesSupported(false);
+}
+
+static const String document_font_effects_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			color: #fff;
+		}
+		p { display: inline-block; }
+		.outline { font-effect: outline(2px #f00); }
+		.glow { font-effect: glow(2px 3px 0px 0px #0f0); }
+	</style>
+</head>
+
+<body>
+<p style="font-size: 14px">Hello world</p>
+<p style="font-size: 20px" class="outline">Hello world</p>
+<p style="font-size: 31px" class="glow">Hello world <strong>π</strong></p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.font_cache")
+{
+	const String cache_path = "font_cache_test.bin";
+	const String cache_path_restored = "font_cache_test_restored.bin";
+
+	auto RenderDocument = [](const String& load_cache_path, const String& save_cache_path) {
+		Context* context = TestsShell::GetContext();
+		REQUIRE(context);
+
+		if (!load_cache_path.empty())
+			CHECK(Rml::LoadFontCache(load_cache_path));
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_font_effects_rml);
+		REQUIRE(document);
+		document->Show();
+		TestsShell::RenderLoop();
+
+		Vector<float> text_widths;
+		for (int i = 0; i < document->GetNumChildren(); i++)
+			text_widths.push_back(document->GetChild(i)->GetBox().GetSize().x);
+
+		CHECK(Rml::SaveFontCache(save_cache_path));
+
+		document->Close();
+		TestsShell::ShutdownShell();
+		return text_widths;
+	};
+
+	auto ReadFile = [](const String& path) {
+		String data;
+		FILE* file = fopen(path.c_str(), "rb");
+		REQUIRE(file);
+		char buffer[4096];
+		size_t num_read = 0;
+		while ((num_read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			data.append(buffer, num_read);
+		fclose(file);
+		return data;
+	};
+
+	const Vector<float> text_widths = RenderDocument({}, cache_path);
+	const Vector<float> text_widths_restored = RenderDocument(cache_path, cache_path_restored);
+	CHECK(text_widths == text_widths_restored);
+
+	// The restored glyphs and layers should be written back exactly as they were generated.
+	const String cache_data = ReadFile(cache_path);
+	CHECK(cache_data.size() > 0);
+	CHECK(cache_data == ReadFile(cache_path_restored));
+
+	// Entries are kept in the cache when restored, thus they are still written after their handles are released.
+	{
+		Context* context = TestsShell::GetContext();
+		CHECK(Rml::LoadFontCache(cache_path));
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_font_effects_rml);
+		REQUIRE(document);
+		document->Show();
+		TestsShell::RenderLoop();
+		document->Close();
+		context->Update();
+
+		Rml::ReleaseFontResources();
+		CHECK(Rml::SaveFontCache(cache_path_restored));
+		CHECK(ReadFile(cache_path_restored) == cache_data);
+		TestsShell::ShutdownShell();
+	}
+
+	// Loading a file which is not a font cache should be rejected.
+	{
+		TestsShell::GetContext();
+		TestsShell::SetNumExpectedWarnings(1);
+		CHECK(!Rml::LoadFontCache("assets/demo.rml"));
+		TestsShell::ShutdownShell();
+	}
+
+	// Files written on a platform with a different byte order should be rejected.
+	{
+		String swapped_data = cache_data;
+		std::reverse(swapped_data.begin() + 8, swapped_data.begin() + 12);
+		FILE* file = fopen(cache_path_restored.c_str(), "wb");
+		REQUIRE(file);
+		fwrite(swapped_data.data(), 1, swapped_data.size(), file);
+		fclose(file);
+
+		TestsShell::GetContext();
+		CHECK(!Rml::LoadFontCache(cache_path_restored));
+		TestsShell::ShutdownShell();
+	}
+
+	remove(cache_path.c_str());
+	remove(cache_path_restored.c_str());
+}
+
+TEST_CASE("core.font_kerning_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; font-size: 17px; }
+	</style>
+</head>
+<body>AVAWAY To Ta Yo</body>
+</rml>
+)");
+	REQUIRE(document);
+	document->Show();
+
+	const FontFaceHandle handle = document->GetFontFaceHandle();
+	REQUIRE(handle);
+
+	// Kerning pairs are cached as the text is laid out.
+	context->Update();
+	const size_t memory_usage = Rml::GetFontKerningCacheMemoryUsage(handle);
+	CHECK(memory_usage > 0);
+
+	// Measuring the same text again uses the cached pairs, and gives the same result.
+	FontEngineInterface* font_engine = GetFontEngineInterface();
+	const String kerned_text = "AVAWAY To Ta Yo";
+	const int width = font_engine->GetStringWidth(handle, kerned_text);
+	CHECK(width == font_engine->GetStringWidth(handle, kerned_text));
+
+	int width_without_kerning = 0;
+	for (char c : kerned_text)
+		width_without_kerning += font_engine->GetStringWidth(handle, String(1, c));
+	CHECK(width < width_without_kerning);
+	CHECK(Rml::GetFontKerningCacheMemoryUsage(handle) == memory_usage);
+
+	// Pairs of any characters are cached, while the memory used is bounded.
+	String text;
+	for (char32_t lhs = 0xc0; lhs < 0x180; lhs++)
+	{
+		for (char32_t rhs = 0xc0; rhs < 0x180; rhs++)
+			text += StringUtilities::ToUTF8(Character(lhs)) + StringUtilities::ToUTF8(Character(rhs)) + ' ';
+	}
+	font_engine->GetStringWidth(handle, text);
+	const size_t memory_usage_extended = Rml::GetFontKerningCacheMemoryUsage(handle);
+	CHECK(memory_usage_extended > memory_usage);
+	CHECK(memory_usage_extended <= 128 * 1024);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_kerning_cache_insert")
+{
+	Rml::FontKerningCache cache;
+	int kerning = 0;
+	CHECK(!cache.Find(Character('A'), Character('V'), kerning));
+
+	cache.Insert(Character('A'), Character('V'), -2);
+	cache.Insert(Character('V'), Character('A'), -1);
+	REQUIRE(cache.Find(Character('A'), Character('V'), kerning));
+	CHECK(kerning == -2);
+
+	// Inserting a pair again replaces its kerning.
+	cache.Insert(Character('A'), Character('V'), -3);
+	REQUIRE(cache.Find(Character('A'), Character('V'), kerning));
+	CHECK(kerning == -3);
+	REQUIRE(cache.Find(Character('V'), Character('A'), kerning));
+	CHECK(kerning == -1);
+	CHECK(cache.GetNumPairs() == 2);
+}
+
+TEST_CASE("core.font_shaped_run_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; font-size: 19px; }
+	</style>
+</head>
+<body>AVAWAY To Ta Yo</body>
+</rml>
+)");
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const FontFaceHandle handle = document->GetFontFaceHandle();
+	REQUIRE(handle);
+	FontEngineInterface* font_engine = GetFontEngineInterface();
+
+	// Runs are shared between strings measured with and without a prior character.
+	const int width = font_engine->GetStringWidth(handle, "AVAWAY");
+	CHECK(width == font_engine->GetStringWidth(handle, "AVAWAY"));
+	CHECK(width == font_engine->GetStringWidth(handle, "AVA") + font_engine->GetStringWidth(handle, "WAY", Character('A')));
+	CHECK(font_engine->GetStringWidth(handle, "A\nV") == font_engine->GetStringWidth(handle, "AV"));
+	CHECK(font_engine->GetStringWidth(handle, "") == 0);
+
+	// Geometry generated from a cached run matches the measured width and the geometry generated when shaping the run.
+	auto generate_vertices = [&](const String& string, int& string_width) {
+		GeometryList geometry;
+		string_width = font_engine->GenerateString(handle, 0, string, Vector2f(10, 20), Colourb(255), 1.f, geometry);
+		Vector<Vector2f> positions;
+		for (Geometry& g : geometry)
+		{
+			for (const Vertex& vertex : g.GetVertices())
+				positions.push_back(vertex.position);
+		}
+		return positions;
+	};
+
+	int generated_width = 0;
+	const Vector<Vector2f> vertices = generate_vertices("To Ta Yo", generated_width);
+	CHECK(generated_width == font_engine->GetStringWidth(handle, "To Ta Yo"));
+	CHECK(vertices.size() == 8 * 4);
+
+	// Fill the cache beyond its capacity, evicting the earlier runs.
+	for (int i = 0; i < 10000; i++)
+		font_engine->GetStringWidth(handle, CreateString(16, "%d", i));
+
+	int regenerated_width = 0;
+	CHECK(generate_vertices("To Ta Yo", regenerated_width) == vertices);
+	CHECK(regenerated_width == generated_width);
+	CHECK(font_engine->GetStringWidth(handle, "AVAWAY") == width);
+
+	// Long strings are not cached, but are shaped the same way.
+	String long_text;
+	for (int i = 0; i < 40; i++)
+		long_text += "AVAWAY";
+	CHECK(font_engine->GetStringWidth(handle, long_text) == width + 39 * font_engine->GetStringWidth(handle, "AVAWAY", Character('Y')));
+	CHECK(font_engine->GetStringWidth(handle, long_text, Character('Y')) == 40 * font_engine->GetStringWidth(handle, "AVAWAY", Character('Y')));
+
+	int long_generated_width = 0;
+	CHECK(generate_vertices(long_text, long_generated_width).size() == 240 * 4);
+	CHECK(long_generated_width == font_engine->GetStringWidth(handle, long_text));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_batching_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { left: 0; top: 0; right: 0; bottom: 0; font-family: LatoLatin; }
+		div { width: 10px; height: 10px; background-color: #f00; border: 1px #00f; }
+		#clip { overflow: hidden; width: 100px; height: 20px; }
+	</style>
+</head>
+<body>
+	<div/><div/><div/><div/><div/><div/><div/><div/>
+	<div id="clip"><div/><div/><div/><div/></div>
+	<div/><div/><div/><div/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.render_batching")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	render_interface->ResetCounters();
+	context->Render();
+	const auto counters_unbatched = counters;
+
+	CHECK(counters_unbatched.render_calls > 0);
+	CHECK(counters_unbatched.render_batched_calls == 0);
+	CHECK(context->GetNumRenderBatches() == 0);
+
+	context->SetRenderBatching(true);
+	CHECK(context->GetRenderBatching());
+
+	render_interface->ResetCounters();
+	context->Render();
+
+	// All geometry is submitted through batches, split only by the clipping region. Redundant scissor changes are dropped.
+	CHECK(counters.render_calls == 0);
+	CHECK(counters.render_batched_calls == (size_t)context->GetNumRenderBatches());
+	CHECK(context->GetNumRenderBatches() == 3);
+	CHECK(counters.enable_scissor <= counters_unbatched.enable_scissor);
+	CHECK(counters.set_scissor == 1);
+
+	context->SetRenderBatching(false);
+	CHECK(!context->GetRenderBatching());
+
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_calls == counters_unbatched.render_calls);
+	CHECK(counters.render_batched_calls == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.colour_multiplier")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	// Support for colour multipliers is queried from the render interface when a context is created.
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	render_interface->SetColourMultiplierSupported(true);
+	Context* context_multiplier = Rml::CreateContext("colour_multiplier", context->GetDimensions());
+	REQUIRE(context_multiplier);
+	render_interface->SetColourMultiplierSupported(false);
+
+	CHECK(Math::MultiplyColour(Colourb(255, 128, 0, 255), Colourb(255, 255, 255, 128)) == Colourb(255, 128, 0, 128));
+	CHECK(Math::MultiplyColour(Colourb(200, 100, 50, 10), Colourb(255)) == Colourb(200, 100, 50, 10));
+
+	render_interface->SetCompiledGeometrySupported(true);
+
+	SUBCASE("geometry")
+	{
+		auto InitializeGeometry = [](Geometry& geometry) {
+			geometry.GetVertices().resize(3);
+			geometry.GetIndices() = {0, 1, 2};
+			for (Vertex& vertex : geometry.GetVertices())
+				vertex.colour = Colourb(200, 100, 50, 255);
+		};
+
+		const Colourb multiplier(255, 255, 255, 128);
+		const Colourb multiplied_colour = Math::MultiplyColour(Colourb(200, 100, 50, 255), multiplier);
+
+		// Without support in the render interface, the geometry is compiled with multiplied vertex colours.
+		Geometry geometry(context);
+		InitializeGeometry(geometry);
+		geometry.SetColourMultiplier(multiplier);
+
+		render_interface->ResetCounters();
+		geometry.Render(Vector2f(0));
+		geometry.Render(Vector2f(0));
+		CHECK(counters.compile_geometry == 1);
+		CHECK(counters.render_compiled_calls == 2);
+		CHECK(Colourb(render_interface->GetLastCompiledVertices()[0].colour) == multiplied_colour);
+		CHECK(geometry.GetVertices()[0].colour == Colourb(200, 100, 50, 255));
+
+		// When the geometry cannot be compiled, the multiplied vertices are reused until the multiplier changes.
+		render_interface->SetCompiledGeometrySupported(false);
+		geometry.Release();
+		render_interface->ResetCounters();
+		geometry.Render(Vector2f(0));
+		geometry.Render(Vector2f(0));
+		CHECK(counters.render_calls == 2);
+		CHECK(geometry.GetVertices()[0].colour == Colourb(200, 100, 50, 255));
+		geometry.SetColourMultiplier(Colourb(255));
+		geometry.Render(Vector2f(0));
+		CHECK(counters.render_calls == 3);
+		render_interface->SetCompiledGeometrySupported(true);
+
+		// With support, the geometry is compiled once with its own colours, and rendered with the multiplier.
+		Geometry geometry_multiplier(context_multiplier);
+		InitializeGeometry(geometry_multiplier);
+		geometry_multiplier.SetColourMultiplier(multiplier);
+
+		render_interface->SetColourMultiplierSupported(true);
+		render_interface->ResetCounters();
+		geometry_multiplier.Render(Vector2f(0));
+		geometry_multiplier.SetColourMultiplier(Colourb(255, 255, 255, 64));
+		geometry_multiplier.Render(Vector2f(0));
+		CHECK(counters.compile_geometry == 1);
+		CHECK(counters.release_compiled_geometry == 0);
+		CHECK(counters.render_compiled_with_colour_calls == 2);
+		CHECK(Colourb(render_interface->GetLastCompiledVertices()[0].colour) == Colourb(200, 100, 50, 255));
+		CHECK(render_interface->GetLastColourMultiplier() == Colourb(255, 255, 255, 64));
+
+		geometry_multiplier.SetColourMultiplier(Colourb(255));
+		geometry_multiplier.Render(Vector2f(0));
+		CHECK(counters.compile_geometry == 1);
+		CHECK(counters.render_compiled_calls == 1);
+		render_interface->SetColourMultiplierSupported(false);
+	}
+
+	SUBCASE("document")
+	{
+		const String document_rml = R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; }
+		div { background-color: #f00; border: 2px #00f; color: #0f0; }
+		p { display: block; height: 20px; decorator: gradient(horizontal #ff0 #0ff); }
+	</style>
+</head>
+<body><div id="panel">Fading panel<p/></div></body>
+</rml>
+)";
+		// Changing the opacity does not compile any geometry again.
+		render_interface->SetColourMultiplierSupported(true);
+		ElementDocument* document = context_multiplier->LoadDocumentFromMemory(document_rml);
+		REQUIRE(document);
+		document->Show();
+		Element* panel = document->GetElementById("panel");
+		REQUIRE(panel);
+
+		context_multiplier->Update();
+		context_multiplier->Render();
+		render_interface->ResetCounters();
+		panel->SetProperty(PropertyId::Opacity, Property(0.5f, Property::NUMBER));
+		context_multiplier->Update();
+		context_multiplier->Render();
+		CHECK(counters.compile_geometry == 0);
+		CHECK(counters.render_compiled_with_colour_calls >= 3);
+		CHECK(render_interface->GetLastColourMultiplier() == Colourb(255, 255, 255, 127));
+
+		// Changing the text colour re-colours the text vertices in place.
+		panel->SetProperty(PropertyId::Opacity, Property(1.f, Property::NUMBER));
+		panel->SetProperty(PropertyId::Color, Property(Colourb(0, 0, 255), Property::COLOUR));
+		context_multiplier->Update();
+		render_interface->ResetCounters();
+		context_multiplier->Render();
+		CHECK(counters.compile_geometry >= 1);
+		const Vector<Vertex>& text_vertices = render_interface->GetLastCompiledVertices();
+		REQUIRE(!text_vertices.empty());
+		for (const Vertex& vertex : text_vertices)
+			CHECK(Colourb(vertex.colour) == Colourb(0, 0, 255));
+
+		// Changing the background colour re-colours the background and border vertices in place.
+		const size_t num_vertices = [&]() {
+			panel->SetProperty(PropertyId::BackgroundColor, Property(Colourb(255, 0, 0, 254), Property::COLOUR));
+			context_multiplier->Update();
+			context_multiplier->Render();
+			return render_interface->GetLastCompiledVertices().size();
+		}();
+		panel->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 255, 0), Property::COLOUR));
+		context_multiplier->Update();
+		render_interface->ResetCounters();
+		context_multiplier->Render();
+		CHECK(counters.compile_geometry == 1);
+		const Vector<Vertex>& background_vertices = render_interface->GetLastCompiledVertices();
+		CHECK(background_vertices.size() == num_vertices);
+		CHECK(std::count_if(background_vertices.begin(), background_vertices.end(),
+				  [](const Vertex& vertex) { return vertex.colour == Colourb(0, 255, 0); }) == 4);
+		CHECK(std::count_if(background_vertices.begin(), background_vertices.end(),
+				  [](const Vertex& vertex) { return vertex.colour == Colourb(0, 0, 255); }) == int(num_vertices) - 4);
+
+		// A transparent background changes the generated vertices, thus the geometry is generated again.
+		panel->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 0, 0), Property::COLOUR));
+		context_multiplier->Update();
+		context_multiplier->Render();
+		CHECK(render_interface->GetLastCompiledVertices().size() == num_vertices - 4);
+
+		document->Close();
+		render_interface->SetColourMultiplierSupported(false);
+
+		// Without support in the render interface, the geometry is compiled again with multiplied colours.
+		document = context->LoadDocumentFromMemory(document_rml);
+		REQUIRE(document);
+		document->Show();
+		panel = document->GetElementById("panel");
+		REQUIRE(panel);
+
+		context->Update();
+		context->Render();
+		panel->SetProperty(PropertyId::Opacity, Property(0.5f, Property::NUMBER));
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		CHECK(counters.compile_geometry >= 3);
+		CHECK(counters.render_compiled_with_colour_calls == 0);
+		for (const Vertex& vertex : render_interface->GetLastCompiledVertices())
+			CHECK(vertex.colour.alpha <= 127);
+
+		document->Close();
+	}
+
+	render_interface->SetCompiledGeometrySupported(false);
+	render_interface->SetColourMultiplierSupported(false);
+	Rml::RemoveContext("colour_multiplier");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.render_dirty")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->SetRenderBatching(true);
+	context->Update();
+	CHECK(context->IsRenderDirty());
+	context->Render();
+	CHECK(!context->IsRenderDirty());
+
+	const int num_batches = context->GetNumRenderBatches();
+	CHECK(num_batches > 0);
+
+	SUBCASE("Unchanged")
+	{
+		// Nothing changed, the retained commands are replayed as is.
+		context->Update();
+		CHECK(!context->IsRenderDirty());
+
+		render_interface->ResetCounters();
+		context->Render();
+		CHECK(counters.render_batched_calls == (size_t)num_batches);
+		CHECK(!context->IsRenderDirty());
+	}
+
+	SUBCASE("Property")
+	{
+		document->GetChild(0)->SetProperty("background-color", "#0f0");
+		context->Update();
+		CHECK(context->IsRenderDirty());
+		context->Render();
+		CHECK(!context->IsRenderDirty());
+	}
+
+	SUBCASE("Offset")
+	{
+		document->GetElementById("clip")->SetScrollTop(5.f);
+		context->Update();
+		CHECK(context->IsRenderDirty());
+	}
+
+	SUBCASE("Hierarchy")
+	{
+		document->AppendChild(document->CreateElement("div"));
+		context->Update();
+		CHECK(context->IsRenderDirty());
+	}
+
+	SUBCASE("Textures")
+	{
+		document->GetChild(0)->SetInnerRML("text");
+		context->Update();
+		context->Render();
+		CHECK(!context->IsRenderDirty());
+
+		Rml::ReleaseTextures();
+		CHECK(context->IsRenderDirty());
+	}
+
+	context->SetRenderBatching(false);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -26,13 +26,17 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
+#include <atomic>
 #include <doctest.h>
 #include <map>
+#include <thread>
 
 using namespace Rml;
 
@@ -449,4 +453,537 @@ TEST_CASE("databinding.inside_string")
 	document->Close();
 
 	TestsShell::ShutdownShell();
-}
\ No newline at end of file
+}
+
+static const String dirty_address_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+
+<body>
+<div data-model="items" id="items">
+<p data-for="item : items">{{ item.count }}</p>
+<p id="name">{{ name }}</p>
+</div>
+</body>
+</rml>
+)";
+
+namespace {
+struct Item {
+	int count = 0;
+};
+} // Anonymous namespace
+
+TEST_CASE("databinding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Item> items(4);
+	String name = "a";
+
+	DataModelConstructor constructor = context->CreateDataModel("items");
+	REQUIRE(static_cast<bool>(constructor));
+	if (auto item_handle = constructor.RegisterStruct<Item>())
+		item_handle.RegisterMember("count", &Item::count);
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	constructor.Bind("name", &name);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(dirty_address_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* element = document->GetElementById("items");
+	REQUIRE(element);
+	REQUIRE(element->GetNumChildren() == 6);
+	CHECK(element->GetChild(1)->GetInnerRML() == "0");
+
+	// Only the views depending on the dirtied member should be updated.
+	items[1].count = 10;
+	items[2].count = 20;
+	handle.DirtyVariable("items[1].count");
+	CHECK(handle.IsVariableDirty("items"));
+	CHECK(!handle.IsVariableDirty("name"));
+	context->Update();
+	CHECK(!handle.IsVariableDirty("items"));
+	CHECK(element->GetChild(1)->GetInnerRML() == "10");
+	CHECK(element->GetChild(2)->GetInnerRML() == "0");
+
+	// Dirtying a parent address updates the views of its members.
+	handle.DirtyVariable("items[2]");
+	context->Update();
+	CHECK(element->GetChild(2)->GetInnerRML() == "20");
+
+	// Other variables are unaffected.
+	name = "b";
+	items[3].count = 30;
+	handle.DirtyVariable("items[3]");
+	context->Update();
+	CHECK(element->GetChild(3)->GetInnerRML() == "30");
+	CHECK(document->GetElementById("name")->GetInnerRML() == "a");
+
+	// Dirtying the whole variable still updates all its views, including structural changes.
+	items.push_back(Item{40});
+	handle.DirtyVariable("items");
+	handle.DirtyVariable("name");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 7);
+	CHECK(element->GetChild(4)->GetInnerRML() == "40");
+	CHECK(document->GetElementById("name")->GetInnerRML() == "b");
+
+	// Dirtying only the structure updates the rows matched by index, as they now refer to other entries.
+	items.insert(items.begin(), Item{50});
+	handle.DirtyVariableStructure("items");
+	CHECK(handle.IsVariableDirty("items"));
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 8);
+	CHECK(element->GetChild(0)->GetInnerRML() == "50");
+	CHECK(element->GetChild(1)->GetInnerRML() == "0");
+	CHECK(element->GetChild(5)->GetInnerRML() == "40");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String keyed_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+
+<body>
+<div data-model="keyed" id="items">
+<p data-for="item, i : items" data-key="item.id" data-class-second="i == 1">{{ i }}: <span>{{ item.name }}</span></p>
+</div>
+</body>
+</rml>
+)";
+
+namespace {
+struct KeyedItem {
+	int id = 0;
+	String name;
+};
+} // Anonymous namespace
+
+TEST_CASE("databinding.keyed_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<KeyedItem> items = { {1, "a"}, {2, "b"}, {3, "c"} };
+
+	DataModelConstructor constructor = context->CreateDataModel("keyed");
+	REQUIRE(static_cast<bool>(constructor));
+	if (auto item_handle = constructor.RegisterStruct<KeyedItem>())
+	{
+		item_handle.RegisterMember("id", &KeyedItem::id);
+		item_handle.RegisterMember("name", &KeyedItem::name);
+	}
+	constructor.RegisterArray<Vector<KeyedItem>>();
+	constructor.Bind("items", &items);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(keyed_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* element = document->GetElementById("items");
+	REQUIRE(element);
+	REQUIRE(element->GetNumChildren() == 4);
+	CHECK(element->GetChild(1)->GetInnerRML() == "1: <span>b</span>");
+
+	Element* row_a = element->GetChild(0);
+	Element* row_b = element->GetChild(1);
+	Element* row_c = element->GetChild(2);
+
+	// Inserting at the front keeps the existing rows, which are moved along with their entries.
+	items.insert(items.begin(), KeyedItem{4, "d"});
+	handle.DirtyVariable("items");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 5);
+	CHECK(element->GetChild(0)->GetInnerRML() == "0: <span>d</span>");
+	CHECK(element->GetChild(1) == row_a);
+	CHECK(element->GetChild(2) == row_b);
+	CHECK(element->GetChild(3) == row_c);
+	CHECK(row_a->GetInnerRML() == "1: <span>a</span>");
+	CHECK(row_a->IsClassSet("second"));
+	CHECK(!row_b->IsClassSet("second"));
+
+	// Removing an entry only removes its row.
+	items.erase(items.begin() + 2);
+	handle.DirtyVariable("items");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 4);
+	CHECK(element->GetChild(1) == row_a);
+	CHECK(element->GetChild(2) == row_c);
+	CHECK(row_c->GetInnerRML() == "2: <span>c</span>");
+
+	// Reordering the entries reorders the rows.
+	std::reverse(items.begin(), items.end());
+	handle.DirtyVariable("items");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 4);
+	CHECK(element->GetChild(0) == row_c);
+	CHECK(element->GetChild(1) == row_a);
+	CHECK(row_c->GetInnerRML() == "0: <span>c</span>");
+	CHECK(element->GetChild(2)->GetInnerRML() == "2: <span>d</span>");
+
+	// The views of moved rows follow their new address.
+	items[1].name = "x";
+	handle.DirtyVariable("items[1].name");
+	context->Update();
+	CHECK(row_a->GetInnerRML() == "1: <span>x</span>");
+
+	// New rows are constructed from the row template.
+	items.push_back(KeyedItem{5, "e"});
+	handle.DirtyVariable("items");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 5);
+	Element* row_e = element->GetChild(3);
+	CHECK(row_e->GetInnerRML() == "3: <span>e</span>");
+	CHECK(!row_e->IsClassSet("second"));
+	CHECK(row_e->HasAttribute("data-class-second"));
+
+	// When only the structure is dirtied, moved rows only update their index, not the views of their entries. Here, the entry is changed
+	// without being dirtied, so that its row keeps the old name.
+	items[1].name = "y";
+	items.insert(items.begin(), KeyedItem{6, "f"});
+	handle.DirtyVariableStructure("items");
+	context->Update();
+	REQUIRE(element->GetNumChildren() == 6);
+	CHECK(element->GetChild(0)->GetInnerRML() == "0: <span>f</span>");
+	CHECK(element->GetChild(2) == row_a);
+	CHECK(row_a->GetInnerRML() == "2: <span>x</span>");
+	CHECK(element->GetChild(4) == row_e);
+	CHECK(row_e->GetInnerRML() == "4: <span>e</span>");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String virtual_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		#list { height: 100px; overflow-y: scroll; }
+		#list p { height: 20px; margin: 0; }
+	</style>
+</head>
+
+<body>
+<div data-model="virtual" id="list">
+<p data-for="item : items" data-virtual="20px">{{ item }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.virtual_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> items(1000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = i;
+
+	DataModelConstructor constructor = context->CreateDataModel("virtual");
+	REQUIRE(static_cast<bool>(constructor));
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("items", &items);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(virtual_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list);
+
+	// Only the rows in view are constructed, while the spacers retain the full scroll height.
+	const int num_children = list->GetNumChildren();
+	CHECK(num_children < 60);
+	CHECK(list->GetScrollHeight() == doctest::Approx(20000.f));
+	CHECK(list->GetChild(1)->GetInnerRML() == "0");
+
+	// Scrolling rebinds the rows to the entries in view.
+	list->SetScrollTop(5000.f);
+	context->Update();
+	context->Render();
+	CHECK(list->GetNumChildren() < 20);
+	CHECK(list->GetChild(1)->GetInnerRML() == "246");
+	CHECK(list->GetChild(2)->GetInnerRML() == "247");
+	CHECK(list->GetChild(list->GetNumChildren() - 3)->GetInnerRML() == "258");
+
+	// Growing the array only grows the scroll height.
+	const int num_children_scrolled = list->GetNumChildren();
+	items.resize(2000, 1);
+	handle.DirtyVariable("items");
+	context->Update();
+	context->Render();
+	CHECK(list->GetNumChildren() == num_children_scrolled);
+	CHECK(list->GetScrollHeight() == doctest::Approx(40000.f));
+
+	// Resizing the scroll container constructs the rows entering the viewport, they are formatted during the following update.
+	list->SetProperty(PropertyId::Height, Property(400.f, Property::PX));
+	context->Update();
+	context->Update();
+	context->Render();
+	CHECK(list->GetNumChildren() == num_children_scrolled + 15);
+	CHECK(list->GetChild(list->GetNumChildren() - 3)->GetInnerRML() == "273");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const char* virtual_for_length_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		#list { height: 100px; overflow-y: scroll; }
+		#list p { height: 10dp; margin: 0; }
+	</style>
+</head>
+
+<body>
+<div data-model="virtual" id="list">
+<p data-for="item : items" %s>{{ item }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.virtual_for_length")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> items(1000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = i;
+
+	DataModelConstructor constructor = context->CreateDataModel("virtual");
+	REQUIRE(static_cast<bool>(constructor));
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("items", &items);
+
+	auto count_spacers = [](Element* list) {
+		int num_spacers = 0;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+			num_spacers += (list->GetChild(i)->GetTagName() == "div" ? 1 : 0);
+		return num_spacers;
+	};
+
+	// Lengths are resolved with the density ratio of the context.
+	context->SetDensityIndependentPixelRatio(2.f);
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(CreateString(1000, virtual_for_length_rml, R"(data-virtual="10dp")"));
+		REQUIRE(document);
+		document->Show();
+
+		context->Update();
+		context->Render();
+
+		Element* list = document->GetElementById("list");
+		REQUIRE(list);
+		CHECK(list->GetScrollHeight() == doctest::Approx(20000.f));
+		CHECK(count_spacers(list) == 2);
+
+		list->SetScrollTop(5000.f);
+		context->Update();
+		context->Render();
+		CHECK(list->GetChild(1)->GetInnerRML() == "246");
+
+		// The spacers are removed together with the data-for element.
+		Element* data_for_element = list->GetChild(list->GetNumChildren() - 1);
+		REQUIRE(data_for_element->HasAttribute("data-for"));
+		list->RemoveChild(data_for_element);
+		context->Update();
+		CHECK(count_spacers(list) == 0);
+
+		document->Close();
+	}
+	context->SetDensityIndependentPixelRatio(1.f);
+
+	// Invalid row heights are rejected, along with the data-for view and the views of its contents.
+	for (const char* row_height : {"50%", "2em", "auto", "0px", "abc"})
+	{
+		TestsShell::SetNumExpectedWarnings(7);
+		const String attribute = CreateString(100, R"(data-virtual="%s")", row_height);
+		ElementDocument* document = context->LoadDocumentFromMemory(CreateString(1000, virtual_for_length_rml, attribute.c_str()));
+		REQUIRE(document);
+		document->Close();
+		context->Update();
+	}
+	TestsShell::SetNumExpectedWarnings(0);
+
+	// Keys are ignored for virtualized rows.
+	{
+		TestsShell::SetNumExpectedWarnings(1);
+		ElementDocument* document = context->LoadDocumentFromMemory(CreateString(1000, virtual_for_length_rml, R"(data-virtual="10dp" data-key="item")"));
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		context->Render();
+		TestsShell::SetNumExpectedWarnings(0);
+
+		Element* list = document->GetElementById("list");
+		REQUIRE(list);
+		CHECK(list->GetScrollHeight() == doctest::Approx(10000.f));
+		CHECK(list->GetChild(1)->GetInnerRML() == "0");
+
+		document->Close();
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+static const String parallel_views_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+
+<body>
+<div data-model="parallel" id="items">
+<p data-for="item : items" data-key="item.id" data-class-big="item.name == 'big'" data-attr-title="item.id * scale">{{ it_index }}: {{ item.name }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.parallel_views")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const int num_items = 200;
+	const std::thread::id main_thread_id = std::this_thread::get_id();
+
+	auto run_test = [&](int num_worker_threads, bool parallel_evaluation) {
+		TestsShell::GetTestsSystemInterface()->SetNumWorkerThreads(num_worker_threads);
+
+		Vector<KeyedItem> items(num_items);
+		for (int i = 0; i < num_items; i++)
+			items[i] = KeyedItem{i, (i % 3 == 0 ? "big" : "small")};
+
+		std::atomic<int> num_worker_thread_calls(0);
+
+		DataModelConstructor constructor = context->CreateDataModel("parallel");
+		REQUIRE(static_cast<bool>(constructor));
+		constructor.SetParallelEvaluation(parallel_evaluation);
+		if (auto item_handle = constructor.RegisterStruct<KeyedItem>())
+		{
+			item_handle.RegisterMember("id", &KeyedItem::id);
+			item_handle.RegisterMember("name", &KeyedItem::name);
+		}
+		constructor.RegisterArray<Vector<KeyedItem>>();
+		constructor.Bind("items", &items);
+		constructor.BindFunc("scale", [&](Variant& variant) {
+			if (std::this_thread::get_id() != main_thread_id)
+				num_worker_thread_calls += 1;
+			variant = 2;
+		});
+		DataModelHandle handle = constructor.GetModelHandle();
+
+		ElementDocument* document = context->LoadDocumentFromMemory(parallel_views_rml);
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+
+		Element* element = document->GetElementById("items");
+		REQUIRE(element);
+		REQUIRE(element->GetNumChildren() == num_items + 1);
+
+		auto check_rows = [&]() {
+			REQUIRE(element->GetNumChildren() == (int)items.size() + 1);
+			for (int i = 0; i < (int)items.size(); i++)
+			{
+				const KeyedItem& item = items[i];
+				Element* row = element->GetChild(i);
+				CHECK(row->GetInnerRML() == CreateString(64, "%d: %s", i, item.name.c_str()));
+				CHECK(row->IsClassSet("big") == (item.name == "big"));
+				CHECK(row->GetAttribute<int>("title", -1) == item.id * 2);
+			}
+		};
+		check_rows();
+
+		// Changing every entry updates all the views.
+		for (KeyedItem& item : items)
+			item.name = (item.name == "big" ? "small" : "big");
+		handle.DirtyVariable("items");
+		context->Update();
+		check_rows();
+
+		// Reversing the entries moves all the rows, their views are rebased during the update.
+		std::reverse(items.begin(), items.end());
+		handle.DirtyVariable("items");
+		context->Update();
+		check_rows();
+
+		// Shrinking the array removes the rows before the views of the remaining rows are evaluated. Evaluating the views of the removed
+		// rows would otherwise log warnings about out of bounds indices.
+		items.resize(10);
+		handle.DirtyVariable("items");
+		context->Update();
+		check_rows();
+
+		document->Close();
+		context->Update();
+		context->RemoveDataModel("parallel");
+
+		return num_worker_thread_calls.load();
+	};
+
+	SUBCASE("Sequential")
+	{
+		CHECK(run_test(0, true) == 0);
+	}
+	SUBCASE("Parallel")
+	{
+		CHECK(run_test(4, true) > 0);
+	}
+	SUBCASE("NotEnabled")
+	{
+		// Models are only evaluated on worker threads when they opt in.
+		CHECK(run_test(4, false) == 0);
+	}
+
+	TestsShell::GetTestsSystemInterface()->SetNumWorkerThreads(0);
+	TestsShell::ShutdownShell();
+}
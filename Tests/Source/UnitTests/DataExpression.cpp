@@ -48,12 +48,22 @@ static String TestExpression(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		Vector<DataAddressCache> address_cache;
+		DataInterpreter interpreter(program, addresses, address_cache, interface);
 
 		if (interpreter.Run())
 			result = interpreter.Result().Get<String>();
 		else
 			FAIL_CHECK("Could not execute expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+
+		// The compiled program must give the same result as the parsed program.
+		Program compiled_program = CompileProgram(program, addresses);
+		DataInterpreter compiled_interpreter(compiled_program, addresses, address_cache, interface);
+
+		if (compiled_interpreter.Run())
+			CHECK_MESSAGE(compiled_interpreter.Result().Get<String>() == result, "Compiled program: \n" << DumpProgram(compiled_program));
+		else
+			FAIL_CHECK("Could not execute compiled expression: " << expression << "\n\n  Compiled program: \n" << DumpProgram(compiled_program));
 	}
 	else
 	{
@@ -64,7 +74,8 @@ static String TestExpression(const String& expression)
 	return result;
 }
 
-static bool TestAssignment(const String& expression)
+// Runs the assignment on the parsed program, or on the compiled program when 'compile' is set.
+static bool TestAssignment(const String& expression, bool compile = false)
 {
 	bool result = false;
 	DataParser parser(expression, interface);
@@ -72,12 +83,16 @@ static bool TestAssignment(const String& expression)
 	{
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
+		if (compile)
+			program = CompileProgram(program, addresses);
+
+		Vector<DataAddressCache> address_cache;
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, address_cache, interface);
 		if (interpreter.Run())
 			result = true;
 		else
-			FAIL_CHECK("Could not execute assignment expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+			FAIL_CHECK("Could not execute assignment expression: " << expression << "\n\n  " << (compile ? "Compiled" : "Parsed") << " program: \n" << DumpProgram(program));
 	}
 	else
 	{
@@ -87,6 +102,47 @@ static bool TestAssignment(const String& expression)
 	return result;
 }
 
+// Runs the event expression on both the parsed and the compiled program, and returns the arguments received by the event callback.
+static StringList TestEventCallback(const String& expression, Event& event, const VariantList& received_arguments)
+{
+	StringList result;
+	DataExpressionInterface event_interface(&model, nullptr, &event);
+	DataParser parser(expression, event_interface);
+	if (parser.Parse(true))
+	{
+		Program program = parser.ReleaseProgram();
+		AddressList addresses = parser.ReleaseAddresses();
+		Vector<DataAddressCache> address_cache;
+
+		DataInterpreter interpreter(program, addresses, address_cache, event_interface);
+		if (interpreter.Run())
+		{
+			for (const Variant& argument : received_arguments)
+				result.push_back(argument.Get<String>());
+		}
+		else
+			FAIL_CHECK("Could not execute event expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+
+		Program compiled_program = CompileProgram(program, addresses);
+		DataInterpreter compiled_interpreter(compiled_program, addresses, address_cache, event_interface);
+		if (compiled_interpreter.Run())
+		{
+			StringList compiled_result;
+			for (const Variant& argument : received_arguments)
+				compiled_result.push_back(argument.Get<String>());
+			CHECK_MESSAGE(compiled_result == result, "Compiled program: \n" << DumpProgram(compiled_program));
+		}
+		else
+			FAIL_CHECK("Could not execute compiled event expression: " << expression << "\n\n  Compiled program: \n" << DumpProgram(compiled_program));
+	}
+	else
+	{
+		Program program = parser.ReleaseProgram();
+		FAIL_CHECK("Could not parse event expression: " << expression << "\n\n  Parsed result: \n" << DumpProgram(program));
+	}
+	return result;
+}
+
 TEST_CASE("Data expressions")
 {
 	float radius = 8.7f;
@@ -151,6 +207,16 @@ TEST_CASE("Data expressions")
 	CHECK(TestAssignment("color_name = concatenate('c','d')"));
 	CHECK(color_name == "c,d");
 
+	CHECK(TestAssignment("radius = 15", true));
+	CHECK(radius == doctest::Approx(15.f));
+	CHECK(TestAssignment("radius = 4; color_name = 'image-color'", true));
+	CHECK(radius == doctest::Approx(4.f));
+	CHECK(color_name == "image-color");
+	CHECK(TestAssignment("color_name = 'a' | concatenate('b')", true));
+	CHECK(color_name == "a,b");
+	CHECK(TestAssignment("color_name = concatenate('c','d')", true));
+	CHECK(color_name == "c,d");
+
 	CHECK(TestExpression("5 == 1 + 2*2 || 8 == 1 + 4  ? 'yes' : 'no'") == "yes");
 	CHECK(TestExpression("!!('fa' + 'lse')") == "0");
 	CHECK(TestExpression("!!('tr' + 'ue')") == "1");
@@ -169,6 +235,7 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("0.2 + 3.42345 | round") == "4");
 	CHECK(TestExpression("(3.42345 | round) + 0.2") == "3.2");
 	CHECK(TestExpression("(3.42345 | format(0)) + 0.2") == "30.2"); // Here, format(0) returns a string, so the + means string concatenation.
+	CHECK(TestExpression("'s' + ((2 | format(1)) * 2)") == "s4");
 
 	CHECK(TestExpression("'Hi' | concatenate") == "Hi");
 	CHECK(TestExpression("'Hi' | concatenate('there')") == "Hi,there");
@@ -192,4 +259,11 @@ TEST_CASE("Data expressions")
 	handle.DirtyVariable("num_trolls");
 	CHECK(TestExpression("concatenate('It takes', num_trolls*3 + ' goats', 'to outsmart', num_trolls | number_suffix('troll','trolls'))") ==
 		"It takes,9 goats,to outsmart,3 trolls");
+
+	VariantList received_arguments;
+	constructor.BindEventCallback("store", [&](DataModelHandle, Event&, const VariantList& arguments) { received_arguments = arguments; });
+
+	Event event;
+	CHECK(TestEventCallback("store('s' + ((2 | format(1)) * 2), 3)", event, received_arguments) == StringList{"s4", "3"});
+	CHECK(TestEventCallback("store(1, 'x'); store('s' + ((2 | format(1)) * 2))", event, received_arguments) == StringList{"s4"});
 }
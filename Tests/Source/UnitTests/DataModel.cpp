@@ -116,3 +116,82 @@ TEST_CASE("Data variables")
 		CHECK(get_result.Get<String>() == "90");
 	}
 }
+
+TEST_CASE("Data variables cached")
+{
+	struct Item {
+		int count = 0;
+		String name;
+	};
+	using ItemVector = Vector<Item>;
+
+	struct Inventory {
+		ItemVector items;
+		Item* selected = nullptr;
+	};
+
+	DataModel model;
+	DataTypeRegister types;
+
+	DataModelConstructor handle(&model, &types);
+
+	if (auto item_handle = handle.RegisterStruct<Item>())
+	{
+		item_handle.RegisterMember("count", &Item::count);
+		item_handle.RegisterMember("name", &Item::name);
+	}
+
+	handle.RegisterArray<ItemVector>();
+
+	if (auto inventory_handle = handle.RegisterStruct<Inventory>())
+	{
+		inventory_handle.RegisterMember("items", &Inventory::items);
+		inventory_handle.RegisterMember("selected", &Inventory::selected);
+	}
+
+	Inventory inventory;
+	inventory.items = { Item{1, "sword"}, Item{2, "shield"} };
+	inventory.selected = &inventory.items[0];
+	handle.Bind("inventory", &inventory);
+
+	auto GetCached = [&model](const String& address_str, DataAddressCache& cache) {
+		Variant result;
+		if (DataVariable variable = model.GetVariable(ParseAddress(address_str), cache))
+			variable.Get(result);
+		return result.Get<String>();
+	};
+
+	DataAddressCache count_cache;
+	CHECK(GetCached("inventory.items[1].count", count_cache) == "2");
+
+	// Reallocate the items, the cache only stores the member definitions so it must stay valid.
+	inventory.items.resize(100);
+	inventory.items[1].count = 5;
+	inventory.items[99].count = 99;
+	CHECK(GetCached("inventory.items[1].count", count_cache) == "5");
+
+	// Addresses differing only by their array indices can share the cache.
+	CHECK(GetCached("inventory.items[99].count", count_cache) == "99");
+
+	inventory.items.resize(1);
+	CHECK(GetCached("inventory.items[1].count", count_cache) == "");
+	CHECK(GetCached("inventory.items[0].count", count_cache) == "1");
+
+	// Members are followed through pointers on every retrieval.
+	DataAddressCache selected_cache;
+	inventory.selected = &inventory.items[0];
+	CHECK(GetCached("inventory.selected.name", selected_cache) == "sword");
+
+	Item other_item{ 7, "bow" };
+	inventory.selected = &other_item;
+	CHECK(GetCached("inventory.selected.name", selected_cache) == "bow");
+
+	inventory.selected = nullptr;
+	CHECK(GetCached("inventory.selected.name", selected_cache) == "");
+
+	// Assigning through the cached variable.
+	DataAddressCache set_cache;
+	REQUIRE(model.GetVariable(ParseAddress("inventory.items[0].name"), set_cache).Set(Variant(String("axe"))));
+	CHECK(inventory.items[0].name == "axe");
+	CHECK(GetCached("inventory.items[0].name", set_cache) == "axe");
+}
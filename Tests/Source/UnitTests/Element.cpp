@@ -294,6 +294,39 @@ TEST_CASE("Element")
 		CHECK(element_ptr->GetInnerRML() == "text");
 	}
 
+	SUBCASE("DirtyUpdate")
+	{
+		Element* element = document->GetFirstChild();
+		Element* span = element->GetChild(1);
+		REQUIRE(span);
+		REQUIRE(span->GetTagName() == "span");
+
+		// Nothing has changed, only the root element should be visited.
+		context->Update();
+		CHECK(context->GetNumUpdatedElements() == 1);
+
+		// Only the path down to the changed element should be visited: root, body, div, and span.
+		span->SetProperty("background-color", "blue");
+		context->Update();
+		CHECK(context->GetNumUpdatedElements() == 4);
+		CHECK(span->GetProperty<String>("background-color") == "0, 0, 255, 255");
+
+		context->Update();
+		CHECK(context->GetNumUpdatedElements() == 1);
+
+		// Inherited properties propagate down to the whole subtree.
+		element->SetProperty("font-size", "20px");
+		context->Update();
+		CHECK(context->GetNumUpdatedElements() > 4);
+		CHECK(span->GetProperty<float>("font-size") == 20.f);
+
+		// Running animations keep the element updating on every frame.
+		span->Animate("opacity", Property(0.5f, Property::NUMBER), 10.f);
+		context->Update();
+		context->Update();
+		CHECK(context->GetNumUpdatedElements() == 4);
+	}
+
 	document->Close();
 	TestsShell::ShutdownShell();
 }
@@ -397,3 +430,302 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+namespace {
+class NestedEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		Element* element = event.GetCurrentElement();
+		if (event == "outer")
+		{
+			// Dispatch a nested event which stops its own propagation, the outer event must be unaffected.
+			element->DispatchEvent("inner", Dictionary{{"value", Variant(2)}}, true);
+
+			outer_values.push_back(event.GetParameter("value", -1));
+			outer_propagating.push_back(event.IsPropagating());
+			outer_current_elements.push_back(event.GetCurrentElement());
+		}
+		else if (event == "inner")
+		{
+			inner_values.push_back(event.GetParameter("value", -1));
+			event.StopPropagation();
+		}
+	}
+
+	Vector<int> outer_values, inner_values;
+	Vector<bool> outer_propagating;
+	ElementList outer_current_elements;
+};
+} // namespace
+
+TEST_CASE("Element.NestedEvents")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory("<rml><body><div id='parent'><div id='child'/></div></body></rml>");
+	REQUIRE(document);
+	document->Show();
+
+	Element* parent = document->GetElementById("parent");
+	Element* child = document->GetElementById("child");
+	REQUIRE(parent);
+	REQUIRE(child);
+
+	NestedEventListener listener;
+	for (Element* element : {parent, child})
+	{
+		element->AddEventListener("outer", &listener);
+		element->AddEventListener("inner", &listener);
+	}
+
+	// Dispatch several times so that the events and dispatch buffers of the previous dispatches are reused.
+	for (int i = 0; i < 3; i++)
+	{
+		listener = NestedEventListener();
+		CHECK(child->DispatchEvent("outer", Dictionary{{"value", Variant(i)}}, true));
+
+		CHECK(listener.outer_values == Vector<int>{i, i});
+		CHECK(listener.outer_propagating == Vector<bool>{true, true});
+		CHECK(listener.outer_current_elements == ElementList{child, parent});
+
+		// The inner events dispatched from the child stop at the child, those from the parent at the parent.
+		CHECK(listener.inner_values == Vector<int>{2, 2});
+	}
+
+	for (Element* element : {parent, child})
+	{
+		element->RemoveEventListener("outer", &listener);
+		element->RemoveEventListener("inner", &listener);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+namespace {
+class CountingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override { counts[event.GetType()] += 1; }
+	int Count(const String& type) { return counts[type]; }
+
+	UnorderedMap<String, int> counts;
+};
+} // namespace
+
+TEST_CASE("Element.ListenedEventsInPath")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory("<rml><body><div id='a'><div id='b'/></div><div id='c'/></body></rml>");
+	REQUIRE(document);
+	document->Show();
+
+	Element* a = document->GetElementById("a");
+	Element* b = document->GetElementById("b");
+	Element* c = document->GetElementById("c");
+	REQUIRE(a);
+	REQUIRE(b);
+	REQUIRE(c);
+
+	CountingEventListener listener;
+	b->AddEventListener(EventId::Mousemove, &listener);
+	b->AddEventListener("custom_one", &listener);
+
+	c->DispatchEvent(EventId::Mousemove, Dictionary());
+	b->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.Count("mousemove") == 1);
+
+	// Custom events share their bit, listening to one custom event must not hide another from the listeners.
+	b->DispatchEvent("custom_two", Dictionary());
+	CHECK(listener.Count("custom_two") == 0);
+	a->AddEventListener("custom_two", &listener);
+	b->DispatchEvent("custom_two", Dictionary());
+	b->DispatchEvent("custom_one", Dictionary());
+	CHECK(listener.Count("custom_two") == 1);
+	CHECK(listener.Count("custom_one") == 1);
+
+	// Moving an element along with its listeners into another subtree.
+	ElementPtr b_ptr = a->RemoveChild(b);
+	c->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.Count("mousemove") == 1);
+
+	b = c->AppendChild(std::move(b_ptr));
+	b->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.Count("mousemove") == 2);
+
+	// Listeners on ancestors receive the events of new descendants.
+	c->AddEventListener(EventId::Scroll, &listener);
+	Element* d = b->AppendChild(document->CreateElement("div"));
+	d->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.Count("scroll") == 1);
+
+	// Removing the listeners stops the events.
+	c->RemoveEventListener(EventId::Scroll, &listener);
+	b->RemoveEventListener(EventId::Mousemove, &listener);
+	d->DispatchEvent(EventId::Scroll, Dictionary());
+	d->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.Count("scroll") == 1);
+	CHECK(listener.Count("mousemove") == 2);
+
+	b->AddEventListener(EventId::Mousemove, &listener);
+	d->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.Count("mousemove") == 3);
+
+	b->RemoveEventListener(EventId::Mousemove, &listener);
+	b->RemoveEventListener("custom_one", &listener);
+	a->RemoveEventListener("custom_two", &listener);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_hit_test_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { left: 0; top: 0; right: 0; bottom: 0; font-family: LatoLatin; font-size: 20px; }
+		div { position: absolute; width: 100px; height: 100px; }
+		#a { left: 50px; top: 50px; z-index: 2; }
+		#b { left: 100px; top: 100px; z-index: 1; }
+		#c { left: 300px; top: 50px; width: 400px; height: 300px; overflow: hidden; }
+		#c div { position: relative; width: 600px; height: 50px; }
+		#d { left: 100px; top: 400px; transform: rotate(45deg) scale(1.5); }
+		#e { left: 120px; top: 420px; pointer-events: none; }
+		#f { left: 800px; top: 50px; width: 20px; }
+		#g { left: 700px; top: 500px; width: 500px; height: 200px; }
+		#g p { display: inline; }
+	</style>
+</head>
+<body>
+	<div id="a"><div id="a_child" style="left: 20px; top: 20px; width: 30px; height: 30px;"/></div>
+	<div id="b"/>
+	<div id="c"><div/><div id="c_scroll"/><div/><div/><div/><div/><div/><div/><div/></div>
+	<div id="d"/>
+	<div id="e"/>
+	<div id="f"/>
+	<div id="g"><p>Some inline text which wraps over several lines, producing multiple boxes for the inline element.</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.GetElementAtPoint")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const Vector2i dimensions = context->GetDimensions();
+
+	// Hit tests after the first one with unchanged geometry use the hit test grid, compare them to the recursive search from the root.
+	auto CheckHitTests = [&](const Element* ignore_element) {
+		context->GetElementAtPoint(Vector2f(0, 0), ignore_element);
+
+		int num_hits = 0;
+		for (int y = -10; y < dimensions.y + 10; y += 7)
+		{
+			for (int x = -10; x < dimensions.x + 10; x += 7)
+			{
+				const Vector2f point = Vector2f(float(x), float(y));
+				Element* expected = context->GetElementAtPoint(point, ignore_element, context->GetRootElement());
+				Element* result = context->GetElementAtPoint(point, ignore_element);
+				if (result != expected)
+				{
+					FAIL_CHECK("Mismatch at point " << x << ", " << y << ": " << (result ? result->GetAddress() : "none") << " vs "
+													<< (expected ? expected->GetAddress() : "none"));
+				}
+				if (result && result != document && result != context->GetRootElement())
+					num_hits += 1;
+			}
+		}
+		CHECK(num_hits > 0);
+	};
+
+	CheckHitTests(nullptr);
+	CheckHitTests(document->GetElementById("a"));
+	CheckHitTests(document->GetElementById("c"));
+
+	CHECK(context->GetElementAtPoint(Vector2f(75, 75)) == document->GetElementById("a_child"));
+	CHECK(context->GetElementAtPoint(Vector2f(60, 60)) == document->GetElementById("a"));
+	CHECK(context->GetElementAtPoint(Vector2f(190, 190)) == document->GetElementById("b"));
+
+	// Scrolled and removed elements must not be found through an outdated grid.
+	document->GetElementById("c")->SetScrollTop(80.f);
+	CheckHitTests(nullptr);
+
+	Element* a = document->GetElementById("a");
+	a->GetParentNode()->RemoveChild(a);
+	CHECK(context->GetElementAtPoint(Vector2f(75, 75)) == document);
+	CheckHitTests(nullptr);
+
+	context->Update();
+	CheckHitTests(nullptr);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Element.HoverWithoutMouseMovement")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* a = document->GetElementById("a");
+	Element* b = document->GetElementById("b");
+	CountingEventListener listener;
+	b->AddEventListener(EventId::Mouseover, &listener);
+
+	context->ProcessMouseMove(250, 130, 0);
+	context->Update();
+	CHECK(context->GetHoverElement() == document);
+
+	// Repeated updates without any changes keep the hover chain.
+	context->Update();
+	context->Update();
+	CHECK(context->GetHoverElement() == document);
+	CHECK(listener.Count("mouseover") == 0);
+
+	// Moving an element below the stationary mouse, the hover chain is updated once the layout is.
+	b->SetProperty("left", "200px");
+	context->Update();
+	context->Update();
+	CHECK(context->GetHoverElement() == b);
+	CHECK(listener.Count("mouseover") == 1);
+
+	context->Update();
+	CHECK(listener.Count("mouseover") == 1);
+
+	// Scrolling moves the children of the scroll container.
+	context->ProcessMouseMove(350, 120, 0);
+	Element* c_scroll = document->GetElementById("c_scroll");
+	CHECK(context->GetHoverElement() == c_scroll);
+
+	document->GetElementById("c")->SetScrollTop(50.f);
+	context->Update();
+	CHECK(context->GetHoverElement() != c_scroll);
+	CHECK(context->GetHoverElement()->GetParentNode() == document->GetElementById("c"));
+
+	// Detached elements leave the hover chain, and their replacement is hovered.
+	context->ProcessMouseMove(60, 60, 0);
+	CHECK(context->GetHoverElement() == a);
+	a->GetParentNode()->RemoveChild(a);
+	context->Update();
+	CHECK(context->GetHoverElement() == document);
+
+	b->RemoveEventListener(EventId::Mouseover, &listener);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
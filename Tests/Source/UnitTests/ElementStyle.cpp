@@ -26,7 +26,9 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -85,3 +87,151 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_definitions_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		div { height: 10px; }
+		.wide div { height: 20px; }
+		.wide div.odd { height: 30px; }
+		.wide div.odd > span { width: 5px; }
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+TEST_CASE("elementstyle.parallel_definitions")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const int num_children = 64;
+
+	auto run_test = [&](int num_worker_threads) {
+		TestsShell::GetTestsSystemInterface()->SetNumWorkerThreads(num_worker_threads);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_definitions_rml);
+		REQUIRE(document);
+
+		String rml;
+		for (int i = 0; i < num_children; i++)
+			rml += (i % 2 ? "<div class='odd'><span/></div>" : "<div><span/></div>");
+		document->SetInnerRML(rml);
+		document->Show();
+		context->Update();
+
+		for (int i = 0; i < num_children; i++)
+			CHECK(document->GetChild(i)->GetProperty<float>("height") == 10.f);
+
+		// Toggling the class on the document dirties the definitions of all the sibling subtrees.
+		document->SetClass("wide", true);
+		context->Update();
+
+		for (int i = 0; i < num_children; i++)
+		{
+			Element* child = document->GetChild(i);
+			CHECK(child->GetProperty<float>("height") == (i % 2 ? 30.f : 20.f));
+			if (i % 2)
+				CHECK(child->GetChild(0)->GetProperty<float>("width") == 5.f);
+		}
+
+		document->Close();
+		context->Update();
+	};
+
+	SUBCASE("Sequential")
+	{
+		run_test(0);
+	}
+	SUBCASE("Parallel")
+	{
+		run_test(4);
+	}
+
+	TestsShell::GetTestsSystemInterface()->SetNumWorkerThreads(0);
+	TestsShell::ShutdownShell();
+}
+
+static const String document_sharing_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 16px; }
+		div { height: 10px; }
+		div.tall { height: 2em; }
+		div.large { font-size: 20px; }
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+TEST_CASE("elementstyle.shared_computed_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+
+	const int num_children = 8;
+
+	String rml;
+	for (int i = 0; i < num_children; i++)
+		rml += "<div class='tall'>text</div>";
+	document->SetInnerRML(rml);
+	document->Show();
+	context->Update();
+
+	const Style::ComputedValues& first_values = document->GetChild(0)->GetComputedValues();
+	for (int i = 1; i < num_children; i++)
+	{
+		const Style::ComputedValues& values = document->GetChild(i)->GetComputedValues();
+		CHECK(values.IsSharedWith(first_values));
+		CHECK(values.height().value == 32.f);
+	}
+
+	// Changing a single element must not affect its siblings.
+	Element* element = document->GetChild(3);
+	element->SetClass("large", true);
+	context->Update();
+
+	CHECK(!element->GetComputedValues().IsSharedWith(first_values));
+	CHECK(element->GetComputedValues().font_size() == 20.f);
+	CHECK(element->GetComputedValues().height().value == 40.f);
+	for (int i = 0; i < num_children; i++)
+	{
+		if (i != 3)
+		{
+			CHECK(document->GetChild(i)->GetComputedValues().font_size() == 16.f);
+			CHECK(document->GetChild(i)->GetComputedValues().height().value == 32.f);
+		}
+	}
+
+	// Inline properties prevent sharing.
+	element = document->GetChild(5);
+	element->SetProperty("height", "15px");
+	context->Update();
+
+	CHECK(!element->GetComputedValues().IsSharedWith(first_values));
+	CHECK(element->GetComputedValues().height().value == 15.f);
+	CHECK(document->GetChild(4)->GetComputedValues().height().value == 32.f);
+
+	// Removing the style again lets the element compute the same values as its siblings.
+	element->RemoveProperty("height");
+	document->GetChild(3)->SetClass("large", false);
+	context->Update();
+
+	for (int i = 0; i < num_children; i++)
+	{
+		CHECK(document->GetChild(i)->GetComputedValues().font_size() == 16.f);
+		CHECK(document->GetChild(i)->GetComputedValues().height().value == 32.f);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -139,3 +139,124 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 300px;
+		}
+		#panel {
+			position: absolute;
+			top: 50px;
+			left: 20px;
+			width: 200px;
+			height: 100px;
+			overflow: hidden;
+		}
+		#float_panel {
+			float: left;
+			width: 100px;
+			height: 50px;
+			overflow: hidden;
+		}
+		#panel div, #content div, #float_panel div {
+			height: 10px;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="content">
+		<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+		<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+	</div>
+	<div id="panel">
+		<div id="first"/>
+		<div id="second"/>
+	</div>
+	<div id="float_panel"><div/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* panel = document->GetElementById("panel");
+	Element* second = document->GetElementById("second");
+	Element* content = document->GetElementById("content");
+	REQUIRE(panel);
+	REQUIRE(second);
+	REQUIRE(content);
+
+	const Vector2f panel_offset = panel->GetAbsoluteOffset();
+	CHECK(panel_offset == Vector2f(20.f, 50.f));
+	CHECK(second->GetAbsoluteOffset() == panel_offset + Vector2f(0.f, 10.f));
+
+	context->Update();
+	CHECK(context->GetNumFormattedElements() == 0);
+
+	// Changes inside the panel should only format the panel and its contents.
+	document->GetElementById("first")->SetProperty("height", "30px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() == 3);
+	CHECK(second->GetAbsoluteOffset() == panel_offset + Vector2f(0.f, 30.f));
+	CHECK(panel->GetBox().GetSize() == Vector2f(200.f, 100.f));
+	CHECK(panel->GetAbsoluteOffset() == panel_offset);
+
+	// Changes to the panel itself affect its parent, thus the whole document needs to be formatted.
+	panel->SetProperty("width", "300px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() > 20);
+	CHECK(panel->GetBox().GetSize() == Vector2f(300.f, 100.f));
+	CHECK(second->GetAbsoluteOffset() == panel_offset + Vector2f(0.f, 30.f));
+
+	// Changes outside any layout boundary format the whole document.
+	content->GetChild(0)->SetProperty("height", "20px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() > 20);
+
+	// Percentage sizes depend on the containing block, thus the panel does not act as a layout boundary with them.
+	panel->SetProperty("height", "20%");
+	context->Update();
+	document->GetElementById("first")->SetProperty("height", "20px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() > 20);
+	panel->SetProperty("height", "100px");
+	context->Update();
+
+	// Floats are only considered when they are positioned, so that they contain any absolutely positioned descendants.
+	Element* float_panel = document->GetElementById("float_panel");
+	REQUIRE(float_panel);
+	float_panel->GetChild(0)->SetProperty("height", "20px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() > 20);
+
+	float_panel->SetProperty("position", "relative");
+	context->Update();
+	float_panel->GetChild(0)->SetProperty("height", "10px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() == 2);
+
+	// Once the panel no longer acts as a layout boundary, its contents format the whole document.
+	panel->SetProperty("overflow", "visible");
+	context->Update();
+	document->GetElementById("first")->SetProperty("height", "10px");
+	context->Update();
+	CHECK(context->GetNumFormattedElements() > 20);
+	CHECK(second->GetAbsoluteOffset() == panel_offset + Vector2f(0.f, 10.f));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
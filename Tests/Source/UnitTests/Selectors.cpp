@@ -426,3 +426,57 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_ancestor_filter_rml = R"(
+<rml>
+<head>
+	<style>
+		.missing p { width: 10px; }
+		.outer p { width: 20px; }
+		.outer > div + p { width: 30px; }
+	</style>
+</head>
+<body>
+	<div class="outer">
+		<div/>
+		<p id="a"/>
+		<p id="b"/>
+	</div>
+	<p id="c"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Selectors.AncestorFilter")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_ancestor_filter_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// The '.missing' rule is never present in the ancestors, and should be rejected without walking up the hierarchy.
+	CHECK(context->GetNumRejectedStyleNodes() >= 3);
+	CHECK(context->GetNumTraversedStyleNodes() > 0);
+
+	CHECK(document->GetElementById("a")->GetProperty<float>("width") == 30.f);
+	CHECK(document->GetElementById("b")->GetProperty<float>("width") == 20.f);
+	CHECK(document->GetElementById("c")->GetProperty<float>("width") == 0.f);
+
+	// Changing an ancestor's class should be reflected by the filter.
+	document->GetChild(0)->SetClass("missing", true);
+	context->Update();
+	CHECK(document->GetElementById("a")->GetProperty<float>("width") == 30.f);
+	CHECK(document->GetElementById("b")->GetProperty<float>("width") == 20.f);
+
+	document->GetChild(0)->SetClassNames("missing");
+	context->Update();
+	CHECK(document->GetElementById("a")->GetProperty<float>("width") == 10.f);
+	CHECK(document->GetElementById("b")->GetProperty<float>("width") == 10.f);
+	CHECK(document->GetElementById("c")->GetProperty<float>("width") == 0.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}